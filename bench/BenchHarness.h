@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace BBEngine
+{
+    namespace Bench
+    {
+        /**
+         * Command line settings shared by every benchmark.
+         */
+        struct Options
+        {
+            int samples = 30;           // timed batches per benchmark
+            int warmupSamples = 3;      // untimed batches first (caches, allocators, branch predictors)
+            double scale = 1.0;         // multiplies every benchmark's batch size (--quick => 0.1)
+            std::string filter;         // only benchmarks whose name contains this
+            std::string format = "json";
+            std::string outPath;        // empty => stdout
+        };
+
+        /**
+         * One benchmark's numbers. Times are nanoseconds per operation; each sample times one
+         * batch of 'opsPerSample' operations, so clock resolution never matters.
+         */
+        struct Result
+        {
+            std::string name;
+            long long opsPerSample = 0;
+            int samples = 0;
+            double minNs = 0.0;
+            double meanNs = 0.0;
+            double p50Ns = 0.0;
+            double p90Ns = 0.0;
+            double p99Ns = 0.0;
+            double maxNs = 0.0;
+            double opsPerSecond = 0.0;
+            std::uint64_t checksum = 0;     // same seeds => same checksum, or the engine's behaviour changed
+        };
+
+        /**
+         * Runs benchmarks and collects their Results.
+         *
+         * A benchmark is a callable taking the batch size and returning a checksum of what it
+         * computed (outcome counts, runs, IDs...). Folding that into the result keeps the work
+         * from being optimized away, and doubles as a determinism check between runs.
+         */
+        class Runner
+        {
+        public:
+            explicit Runner(const Options& options)
+                : options(options)
+            {
+            }
+
+            template<typename Fn>
+            void run(const std::string& name, long long opsPerSample, Fn&& fn)
+            {
+                if (!options.filter.empty() && name.find(options.filter) == std::string::npos)
+                    return;
+
+                long long ops = static_cast<long long>(opsPerSample * options.scale);
+                if (ops < 1)
+                    ops = 1;
+
+                for (int i = 0; i < options.warmupSamples; ++i)
+                    fn(ops);
+
+                using Clock = std::chrono::steady_clock;
+                std::vector<double> perOp;
+                perOp.reserve(options.samples);
+                std::uint64_t checksum = 0;
+                for (int i = 0; i < options.samples; ++i)
+                {
+                    auto start = Clock::now();
+                    std::uint64_t sum = fn(ops);
+                    auto stop = Clock::now();
+
+                    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+                    perOp.push_back(ns / static_cast<double>(ops));
+                    checksum = checksum * 31 + sum;
+                }
+
+                results.push_back(summarize(name, ops, perOp, checksum));
+            }
+
+            const std::vector<Result>& getResults() const
+            {
+                return results;
+            }
+
+            void writeJson(std::ostream& out, const std::string& buildInfo) const
+            {
+                out << std::setprecision(6);
+                out << "{\n  \"build\": \"" << buildInfo << "\",\n"
+                    << "  \"samples\": " << options.samples << ",\n"
+                    << "  \"warmup\": " << options.warmupSamples << ",\n"
+                    << "  \"scale\": " << options.scale << ",\n"
+                    << "  \"benchmarks\": [\n";
+                for (std::size_t i = 0; i < results.size(); ++i)
+                {
+                    const Result& r = results[i];
+                    out << "    { \"name\": \"" << r.name << "\""
+                        << ", \"ops_per_sample\": " << r.opsPerSample
+                        << ", \"samples\": " << r.samples
+                        << ", \"min_ns\": " << r.minNs
+                        << ", \"mean_ns\": " << r.meanNs
+                        << ", \"p50_ns\": " << r.p50Ns
+                        << ", \"p90_ns\": " << r.p90Ns
+                        << ", \"p99_ns\": " << r.p99Ns
+                        << ", \"max_ns\": " << r.maxNs
+                        << ", \"ops_per_sec\": " << r.opsPerSecond
+                        << ", \"checksum\": \"" << std::hex << r.checksum << std::dec << "\" }"
+                        << (i + 1 < results.size() ? ",\n" : "\n");
+                }
+                out << "  ]\n}\n";
+            }
+
+            void writeCsv(std::ostream& out) const
+            {
+                out << std::setprecision(6);
+                out << "name,ops_per_sample,samples,min_ns,mean_ns,p50_ns,p90_ns,p99_ns,max_ns,ops_per_sec,checksum\n";
+                for (const Result& r : results)
+                {
+                    out << r.name << ',' << r.opsPerSample << ',' << r.samples << ','
+                        << r.minNs << ',' << r.meanNs << ',' << r.p50Ns << ',' << r.p90Ns << ','
+                        << r.p99Ns << ',' << r.maxNs << ',' << r.opsPerSecond << ','
+                        << std::hex << r.checksum << std::dec << '\n';
+                }
+            }
+
+        private:
+            // Nearest-rank percentile of an ascending list
+            static double percentile(const std::vector<double>& sorted, double p)
+            {
+                std::size_t rank = static_cast<std::size_t>(p / 100.0 * sorted.size() + 0.999999);
+                rank = std::min(std::max<std::size_t>(rank, 1), sorted.size());
+                return sorted[rank - 1];
+            }
+
+            static Result summarize(const std::string& name, long long ops,
+                std::vector<double> perOp, std::uint64_t checksum)
+            {
+                Result r;
+                r.name = name;
+                r.opsPerSample = ops;
+                r.samples = static_cast<int>(perOp.size());
+                r.checksum = checksum;
+                if (perOp.empty())
+                    return r;
+
+                std::sort(perOp.begin(), perOp.end());
+                double total = 0.0;
+                for (double v : perOp)
+                    total += v;
+
+                r.minNs = perOp.front();
+                r.maxNs = perOp.back();
+                r.meanNs = total / perOp.size();
+                r.p50Ns = percentile(perOp, 50.0);
+                r.p90Ns = percentile(perOp, 90.0);
+                r.p99Ns = percentile(perOp, 99.0);
+                r.opsPerSecond = r.p50Ns > 0.0 ? 1e9 / r.p50Ns : 0.0;
+                return r;
+            }
+
+            Options options;
+            std::vector<Result> results;
+        };
+
+    } // namespace Bench
+} // namespace BBEngine
@@ -0,0 +1,576 @@
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchHarness.h"
+#include "Team.h"
+#include "Player.h"
+#include "PlayerStats.h"
+#include "PlayerAttributes.h"
+#include "StartingRotation.h"
+#include "BoxScore.h"
+#include "Simulator.h"
+#include "GameManager.h"
+#include "GameEventLog.h"
+#include "GameReplay.h"
+#include "Standings.h"
+#include "Season.h"
+#include "League.h"
+#include "StatsManager.h"
+#include "TestLeague.h"
+
+using namespace BBEngine;
+using namespace BBEngine::Bench;
+
+// ----------------------------------------------------
+// Reproducible microbenchmarks for the engine's hot paths.
+//
+//   BaseballEngineBench [--format=json|csv] [--out=FILE] [--filter=SUBSTR]
+//                       [--samples=N] [--warmup=N] [--scale=X] [--quick]
+//
+// Every seed is fixed, so two runs of the same build do exactly the same work (compare the
+// checksums). Build with -DCMAKE_BUILD_TYPE=Release; unoptimized numbers are meaningless.
+// ----------------------------------------------------
+
+namespace
+{
+    const std::uint64_t SimSeed = 2024;
+    const unsigned RatingSeed = 7;
+
+    // ----------------------------------------------------
+    // Pitch model
+    // ----------------------------------------------------
+    struct Matchups
+    {
+        std::vector<PitcherRatings> pitchers;
+        std::vector<BatterRatings> batters;
+        std::vector<PitchContext> counts;
+
+        explicit Matchups(std::size_t n)
+        {
+            std::mt19937 gen(RatingSeed);
+            std::uniform_int_distribution<int> rating(1, 99);
+            std::uniform_int_distribution<int> balls(0, 3);
+            std::uniform_int_distribution<int> strikes(0, 2);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                PitcherRatings p;
+                p.control = static_cast<std::uint8_t>(rating(gen));
+                p.velocity = static_cast<std::uint8_t>(rating(gen));
+                BatterRatings b;
+                b.contact = static_cast<std::uint8_t>(rating(gen));
+                b.power = static_cast<std::uint8_t>(rating(gen));
+                b.discipline = static_cast<std::uint8_t>(rating(gen));
+                PitchContext ctx;
+                ctx.balls = balls(gen);
+                ctx.strikes = strikes(gen);
+                pitchers.push_back(p);
+                batters.push_back(b);
+                counts.push_back(ctx);
+            }
+        }
+    };
+
+    void benchPitchModel(Runner& runner)
+    {
+        const std::size_t mask = 1023;
+        Matchups m(mask + 1);
+        StadiumContext stadium;
+
+        runner.run("simulator/simulatePitch", 200000, [&](long long ops)
+        {
+            Simulator sim(SimSeed);
+            sim.beginGame(1);
+            std::uint64_t sum = 0;
+            for (long long i = 0; i < ops; ++i)
+            {
+                std::size_t k = static_cast<std::size_t>(i) & mask;
+                sum += static_cast<std::uint64_t>(sim.simulatePitch(m.pitchers[k], m.batters[k], stadium, m.counts[k]));
+            }
+            return sum;
+        });
+
+        // The model's distances stay under ~120 ft, so against real fences every ball is a SINGLE
+        // and the checksum would never move. Short fences make the outcome depend on the distance,
+        // random draw included.
+        StadiumContext shortFences[4];
+        for (int f = 0; f < 4; ++f)
+        {
+            const double fence = 60.0 + 15.0 * f;
+            shortFences[f].fenceDistanceLeft = fence;
+            shortFences[f].fenceDistanceCenter = fence;
+            shortFences[f].fenceDistanceRight = fence;
+        }
+
+        runner.run("simulator/computeBattedBallOutcome", 200000, [&](long long ops)
+        {
+            Simulator sim(SimSeed);
+            sim.beginGame(1);
+            std::uint64_t sum = 0;
+            for (long long i = 0; i < ops; ++i)
+            {
+                std::size_t k = static_cast<std::size_t>(i) & mask;
+                BattedBallOutcome outcome = sim.computeBattedBallOutcome(m.pitchers[k], m.batters[k], shortFences[i & 3]);
+                sum = sum * 31 + static_cast<std::uint64_t>(outcome);
+            }
+            return sum;
+        });
+
+        // The batched kernel, per pitch, for comparison with simulatePitch
+        std::deque<PlayerAttributes> attrs(2 * (mask + 1));
+        std::vector<PitchMatchup> pairs(mask + 1);
+        for (std::size_t k = 0; k <= mask; ++k)
+        {
+            PlayerAttributes& pitcher = attrs[2 * k];
+            PlayerAttributes& batter = attrs[2 * k + 1];
+            pitcher.setPitchControl(m.pitchers[k].control);
+            pitcher.setPitchVelocity(m.pitchers[k].velocity);
+            batter.setContact(m.batters[k].contact);
+            batter.setPower(m.batters[k].power);
+            batter.setPlateDiscipline(m.batters[k].discipline);
+            pairs[k].pitcher = &pitcher;
+            pairs[k].batter = &batter;
+        }
+        std::vector<PitchOutcome> outcomes(mask + 1);
+
+        runner.run("simulator/simulatePitches_batch", 200000, [&](long long ops)
+        {
+            Simulator sim(SimSeed);
+            sim.beginGame(1);
+            std::uint64_t sum = 0;
+            for (long long done = 0; done < ops; done += static_cast<long long>(pairs.size()))
+            {
+                std::size_t n = static_cast<std::size_t>(std::min<long long>(ops - done, pairs.size()));
+                sim.simulatePitches(pairs.data(), m.counts.data(), n, stadium, outcomes.data());
+                for (std::size_t k = 0; k < n; ++k)
+                    sum += static_cast<std::uint64_t>(outcomes[k]);
+            }
+            return sum;
+        });
+    }
+
+    // ----------------------------------------------------
+    // Games & box scores
+    // ----------------------------------------------------
+    void benchGames(Runner& runner)
+    {
+        TestLeague league(2, RatingSeed);
+        BoxScore box("Team0", "Team1");
+        Simulator sim(SimSeed);
+
+        // One op = one full game, with the BoxScore reused the way Season reuses its pool
+        runner.run("game/runGame", 200, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long g = 0; g < ops; ++g)
+            {
+                box.reset("Team0", "Team1");
+                sim.beginGame(static_cast<int>(g));
+                GameManager gm(league.teams[0], league.teams[1], &box, &sim);
+                gm.runGame();
+                sum += static_cast<std::uint64_t>(box.getHomeTeamRuns() * 100 + box.getAwayTeamRuns());
+            }
+            return sum;
+        });
+
+        // The same games, recording every pitch into a reused event log
+        GameEventLog log;
+        runner.run("game/runGame_eventLog", 200, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long g = 0; g < ops; ++g)
+            {
+                box.reset("Team0", "Team1");
+                log.clear(static_cast<int>(g));
+                sim.beginGame(static_cast<int>(g));
+                GameManager gm(league.teams[0], league.teams[1], &box, &sim);
+                gm.setEventLog(&log);
+                gm.runGame();
+                sum += static_cast<std::uint64_t>(box.getHomeTeamRuns() * 100 + box.getAwayTeamRuns()) + log.size();
+            }
+            return sum;
+        });
+
+        // Rebuilding a recorded game's box score from its log, and jumping into the middle of it
+        log.clear(1);
+        box.reset("Team0", "Team1");
+        sim.beginGame(1);
+        {
+            GameManager gm(league.teams[0], league.teams[1], &box, &sim);
+            gm.setEventLog(&log);
+            gm.runGame();
+        }
+        GameReplay replay(league.teams[0], league.teams[1], log);
+
+        runner.run("replay/replay_game", 200, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long g = 0; g < ops; ++g)
+            {
+                GameState state = replay.replay(box);
+                sum += static_cast<std::uint64_t>(box.getHomeTeamRuns() * 100 + box.getAwayTeamRuns()) + state.inning;
+            }
+            return sum;
+        });
+
+        runner.run("replay/seek_bottom_7th", 2000, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long g = 0; g < ops; ++g)
+            {
+                GameState state = replay.seek(7, true, box);
+                sum += static_cast<std::uint64_t>(box.getHomeTeamRuns() + state.batterIndex[1]);
+            }
+            return sum;
+        });
+
+        // What-if continuations: fork from the bottom of the 7th and play it out
+        box.reset("Team0", "Team1");
+        sim.beginGame(1);
+        GameSnapshot snapshot;
+        {
+            GameManager gm(league.teams[0], league.teams[1], &box, &sim);
+            while (!(gm.getState().inning == 7 && !gm.getState().topOfInning))
+                gm.playPitch();
+            snapshot = gm.takeSnapshot();
+        }
+        BoxScore forkBox("Team0", "Team1");
+        Simulator forkSim(SimSeed);
+
+        runner.run("snapshot/fork_bottom_7th", 2000, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long g = 0; g < ops; ++g)
+            {
+                GameSnapshot branch = snapshot;
+                branch.rngStream = static_cast<std::uint32_t>(1000 + g);
+                GameManager gm(league.teams[0], league.teams[1], &forkBox, &forkSim);
+                gm.restoreSnapshot(branch);
+                gm.runGame();
+                sum += static_cast<std::uint64_t>(forkBox.getHomeTeamRuns() * 100 + forkBox.getAwayTeamRuns());
+            }
+            return sum;
+        });
+
+        // One op = a game's worth of box score traffic: 9 innings of ~4 plate appearances a side
+        std::vector<Player*> home, away;
+        for (Player* p : league.teams[0]->getLineupVsRHP()) home.push_back(p);
+        for (Player* p : league.teams[1]->getLineupVsRHP()) away.push_back(p);
+        Player* homePitcher = league.teams[0]->getRotation()->getNextStarter();
+        Player* awayPitcher = league.teams[1]->getRotation()->getNextStarter();
+
+        runner.run("boxscore/record_game_slots", 20000, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long g = 0; g < ops; ++g)
+            {
+                box.reset("Team0", "Team1");
+                int homeSlots[9], awaySlots[9];
+                for (int i = 0; i < 9; ++i)
+                {
+                    homeSlots[i] = box.addBatterToLineup(true, home[i]);
+                    awaySlots[i] = box.addBatterToLineup(false, away[i]);
+                }
+                int homeP = box.addPitcher(true, homePitcher);
+                int awayP = box.addPitcher(false, awayPitcher);
+
+                int batter = 0;
+                for (int inning = 1; inning <= 9; ++inning)
+                {
+                    box.setCurrentInning(inning);
+                    for (int side = 0; side < 2; ++side)
+                    {
+                        bool isHome = side == 1;
+                        const int* slots = isHome ? homeSlots : awaySlots;
+                        for (int pa = 0; pa < 4; ++pa, ++batter)
+                        {
+                            int slot = slots[batter % 9];
+                            switch (batter % 4)
+                            {
+                            case 0: box.recordAtBatInSlot(isHome, slot, 1, 1, 0, 0, 0, 1, 0, 0, 1); break;
+                            case 1: box.recordStrikeoutInSlot(isHome, slot); break;
+                            case 2: box.recordWalkInSlot(isHome, slot); break;
+                            default: box.recordAtBatInSlot(isHome, slot); break;
+                            }
+                        }
+                        box.recordPitchingInSlot(!isHome, isHome ? awayP : homeP, 1.0, 1, 1, 1, 1, 1);
+                    }
+                }
+                sum += static_cast<std::uint64_t>(box.getHomeTeamRuns() + box.getAwayTeamHits());
+            }
+            return sum;
+        });
+
+        // The same traffic through the Player* convenience methods (one slot lookup each)
+        runner.run("boxscore/record_game_players", 20000, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long g = 0; g < ops; ++g)
+            {
+                box.reset("Team0", "Team1");
+                int batter = 0;
+                for (int inning = 1; inning <= 9; ++inning)
+                {
+                    box.setCurrentInning(inning);
+                    for (int side = 0; side < 2; ++side)
+                    {
+                        bool isHome = side == 1;
+                        const std::vector<Player*>& lineup = isHome ? home : away;
+                        for (int pa = 0; pa < 4; ++pa, ++batter)
+                        {
+                            Player* p = lineup[batter % 9];
+                            switch (batter % 4)
+                            {
+                            case 0: box.recordHit(isHome, p); break;
+                            case 1: box.recordStrikeout(isHome, p); break;
+                            case 2: box.recordWalk(isHome, p); break;
+                            default: box.recordAtBat(isHome, p); break;
+                            }
+                        }
+                        box.recordPitching(!isHome, isHome ? awayPitcher : homePitcher, 1.0, 1, 1, 1, 1, 1);
+                    }
+                }
+                sum += static_cast<std::uint64_t>(box.getHomeTeamHits() + box.getAwayTeamHits());
+            }
+            return sum;
+        });
+    }
+
+    // ----------------------------------------------------
+    // Standings
+    // ----------------------------------------------------
+    void benchStandings(Runner& runner)
+    {
+        std::deque<Team> teamStore;
+        std::vector<Team*> teams;
+        for (int t = 0; t < 30; ++t)
+        {
+            teamStore.emplace_back("Team" + std::to_string(t), "MLB");
+            teams.push_back(&teamStore.back());
+        }
+
+        // A fixed list of results, a day (15 games) at a time
+        std::mt19937 gen(RatingSeed);
+        std::vector<std::pair<Team*, Team*>> results;
+        for (int day = 0; day < 162; ++day)
+        {
+            std::vector<Team*> order = teams;
+            std::shuffle(order.begin(), order.end(), gen);
+            for (std::size_t i = 0; i + 1 < order.size(); i += 2)
+                results.emplace_back(order[i], order[i + 1]);
+        }
+
+        // One op = one day: 15 results, then the standings are brought up to date
+        runner.run("standings/updateStandings_day", 162, [&](long long ops)
+        {
+            Standings standings(teams);
+            std::size_t next = 0;
+            for (long long day = 0; day < ops; ++day)
+            {
+                for (int g = 0; g < 15; ++g, ++next)
+                {
+                    const auto& r = results[next % results.size()];
+                    standings.recordGameResult(r.first, r.second);
+                }
+                standings.updateStandings();
+            }
+            return static_cast<std::uint64_t>(standings.getOverallStandings().front().wins);
+        });
+    }
+
+    // ----------------------------------------------------
+    // Leaderboards
+    // ----------------------------------------------------
+    void benchLeaders(Runner& runner)
+    {
+        // Roughly a full league's worth of players with a season of counters
+        const int playerCount = 1200;
+        std::deque<PlayerAttributes> attributes(playerCount);
+        std::deque<PlayerStats> stats(playerCount);
+        std::deque<Player> players;
+        std::mt19937 gen(RatingSeed);
+        std::uniform_int_distribution<int> atBats(0, 650);
+        std::uniform_int_distribution<int> outs(0, 600);
+
+        StatsManager manager;
+        for (int i = 0; i < playerCount; ++i)
+        {
+            PlayerStats& s = stats[i];
+            int ab = atBats(gen);
+            int hits = ab / 4 + static_cast<int>(gen() % 40);
+            s.addAtBats(ab);
+            s.addHits(hits);
+            s.addDoubles(hits / 5);
+            s.addHomeRuns(static_cast<int>(gen() % 50));
+            s.addWalks(ab / 10);
+            s.addRBIs(static_cast<int>(gen() % 120));
+            int o = outs(gen);
+            if (o > 0)
+            {
+                s.addInningsPitched(o / 3.0);
+                s.addEarnedRuns(o / 9 + static_cast<int>(gen() % 20));
+                s.addHitsAllowed(o / 3);
+                s.addWalksAllowed(o / 10);
+            }
+            players.emplace_back("Player" + std::to_string(i), 25, Handedness::Right, &attributes[i], &s);
+            manager.registerPlayer(&players.back());
+        }
+
+        runner.run("stats/getLeaders_OPS", 200, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long i = 0; i < ops; ++i)
+                sum += static_cast<std::uint64_t>(manager.getPlayerID(manager.getLeaders(StatId::OPS, 10).front().first));
+            return sum;
+        });
+
+        runner.run("stats/getLeaders_ERA_string", 200, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long i = 0; i < ops; ++i)
+                sum += static_cast<std::uint64_t>(manager.getPlayerID(manager.getLeaders("ERA", 10, true).front().first));
+            return sum;
+        });
+
+        runner.run("stats/getQualifiedLeaders_AVG", 200, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long i = 0; i < ops; ++i)
+                sum += static_cast<std::uint64_t>(manager.getPlayerID(manager.getQualifiedLeaders(StatId::AVG, 10, 162).front().first));
+            return sum;
+        });
+    }
+
+    // ----------------------------------------------------
+    // A whole season through the League
+    // ----------------------------------------------------
+    void benchLeagueSeason(Runner& runner, const std::string& name, int teamCount, int workerThreads)
+    {
+        TestLeague bench(teamCount, RatingSeed);
+        League league;
+        for (Team* team : bench.teams)
+            league.addTeam(team);
+
+        runner.run(name, 1, [&](long long ops)
+        {
+            std::uint64_t sum = 0;
+            for (long long s = 0; s < ops; ++s)
+            {
+                league.startNewSeason();
+                league.getCurrentSeason()->setSeed(SimSeed);
+                league.getCurrentSeason()->setWorkerThreads(workerThreads);
+                while (league.getCurrentSeason())
+                    league.advanceOneDay();
+
+                const SeasonSummary& summary = league.getPastSeasons().back();
+                sum += static_cast<std::uint64_t>(summary.gamesPlayed) * 1000
+                    + static_cast<std::uint64_t>(summary.finalStandings.front().wins);
+            }
+            return sum;
+        });
+    }
+
+    // ----------------------------------------------------
+    // Command line
+    // ----------------------------------------------------
+    bool parseArgs(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            auto value = [&](const std::string& key) { return arg.substr(key.size()); };
+
+            if (arg.rfind("--format=", 0) == 0) options.format = value("--format=");
+            else if (arg.rfind("--out=", 0) == 0) options.outPath = value("--out=");
+            else if (arg.rfind("--filter=", 0) == 0) options.filter = value("--filter=");
+            else if (arg.rfind("--samples=", 0) == 0) options.samples = std::atoi(value("--samples=").c_str());
+            else if (arg.rfind("--warmup=", 0) == 0) options.warmupSamples = std::atoi(value("--warmup=").c_str());
+            else if (arg.rfind("--scale=", 0) == 0) options.scale = std::atof(value("--scale=").c_str());
+            else if (arg == "--quick")
+            {
+                options.samples = 5;
+                options.warmupSamples = 1;
+                options.scale = 0.1;
+            }
+            else
+            {
+                std::cerr << "[Bench] Unknown argument: " << arg << "\n";
+                return false;
+            }
+        }
+
+        if (options.format != "json" && options.format != "csv")
+        {
+            std::cerr << "[Bench] --format must be json or csv.\n";
+            return false;
+        }
+        if (options.samples < 1 || options.warmupSamples < 0 || options.scale <= 0.0)
+        {
+            std::cerr << "[Bench] --samples must be >= 1, --warmup >= 0, --scale > 0.\n";
+            return false;
+        }
+        return true;
+    }
+
+    std::string buildInfo()
+    {
+        std::ostringstream info;
+#if defined(__clang__)
+        info << "clang " << __clang_major__ << "." << __clang_minor__;
+#elif defined(__GNUC__)
+        info << "gcc " << __GNUC__ << "." << __GNUC_MINOR__;
+#elif defined(_MSC_VER)
+        info << "msvc " << _MSC_VER;
+#endif
+#if defined(NDEBUG)
+        info << " release";
+#else
+        info << " debug";
+#endif
+        return info.str();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseArgs(argc, argv, options))
+        return 2;
+
+#if !defined(NDEBUG)
+    std::cerr << "[Bench] Warning: not a release build; configure with -DCMAKE_BUILD_TYPE=Release.\n";
+#endif
+
+    // The engine logs nowhere unless a sink is installed, so nothing to silence here
+    Runner runner(options);
+    benchPitchModel(runner);
+    benchGames(runner);
+    benchStandings(runner);
+    benchLeaders(runner);
+    benchLeagueSeason(runner, "league/season_12teams", 12, 1);
+    benchLeagueSeason(runner, "league/season_12teams_parallel", 12, 0);
+
+    std::ofstream file;
+    if (!options.outPath.empty())
+    {
+        file.open(options.outPath);
+        if (!file)
+        {
+            std::cerr << "[Bench] Could not open " << options.outPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream& out = options.outPath.empty() ? std::cout : file;
+
+    if (options.format == "csv")
+        runner.writeCsv(out);
+    else
+        runner.writeJson(out, buildInfo());
+    return 0;
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BBEngine
+{
+    class PlayerAttributes;
+
+    /**
+     * Every rating a PlayerAttributes carries, in a fixed order. Used as the column index
+     * of an AttributeTable.
+     */
+    enum class Attribute : std::uint8_t
+    {
+        Contact,
+        Power,
+        PlateDiscipline,
+        PitchVelocity,
+        PitchControl,
+        PitchMovement,
+        Stamina,
+        ReactionTime,
+        ArmAccuracy,
+        FieldingRange,
+        Speed,
+        Durability,
+        Clutch,
+        Count
+    };
+
+    constexpr std::size_t AttributeCount = static_cast<std::size_t>(Attribute::Count);
+
+    /**
+     * One rating threshold for AttributeTable::findPlayers(): value >= minValue.
+     */
+    struct AttributeThreshold
+    {
+        Attribute attribute;
+        int minValue;
+    };
+
+    /**
+     * League-wide attribute store, laid out as a structure of arrays: each rating is its own
+     * contiguous column of uint8_t (ratings are always 1..99), indexed by a dense player ID.
+     *
+     * Bulk work (aging the whole organization, clamping after a load, rating filters for
+     * scouting) runs as a straight loop over one or two columns instead of chasing a
+     * PlayerAttributes pointer per player, so the compiler can vectorize it.
+     *
+     * A PlayerAttributes can be bound to a row (see PlayerAttributes::bindToTable()) and then
+     * acts as a view: its getters/setters read and write the table. Player IDs are never reused
+     * or reordered, so a bound view stays valid while the table grows.
+     */
+    class AttributeTable
+    {
+    public:
+        AttributeTable() = default;
+
+        /**
+         * Add a player with every rating at 50 (the PlayerAttributes default). Returns its ID.
+         */
+        int addPlayer();
+
+        /**
+         * Add a player with a copy of someone's ratings. Returns its ID.
+         */
+        int addPlayer(const PlayerAttributes& initial);
+
+        /**
+         * Pre-size every column, e.g. before loading a whole organizational database.
+         */
+        void reserve(std::size_t players);
+
+        std::size_t size() const;
+        bool empty() const;
+
+        /**
+         * Single-cell access. set() clamps to [1..99] like the PlayerAttributes setters.
+         */
+        int get(Attribute attribute, int playerID) const;
+        void set(Attribute attribute, int playerID, int value);
+
+        /**
+         * Raw column access for kernels of your own; size() entries each.
+         */
+        const std::uint8_t* column(Attribute attribute) const;
+        std::uint8_t* column(Attribute attribute);
+
+        // ----------------------------------------------------------------
+        // Bulk operations (the whole table in one sweep)
+        // ----------------------------------------------------------------
+        /**
+         * PlayerAttributes::ageOneYear() for every player: velocity -1, control +1, durability -1.
+         */
+        void ageOneYear();
+
+        /**
+         * Force every rating of every player into [1..99].
+         */
+        void clampAllAttributes();
+
+        /**
+         * Per-player (contact + power + plateDiscipline) / 3, indexed by player ID.
+         */
+        void averageHittingRatings(std::vector<double>& out) const;
+
+        /**
+         * Per-player (velocity + control + movement) / 3, indexed by player ID.
+         */
+        void averagePitchingRatings(std::vector<double>& out) const;
+
+        /**
+         * IDs (ascending) of every player at or above minValue in one rating.
+         */
+        std::vector<int> findPlayers(Attribute attribute, int minValue) const;
+
+        /**
+         * IDs (ascending) of every player meeting all the thresholds,
+         * e.g. { {Attribute::Contact, 70}, {Attribute::Speed, 60} }.
+         */
+        std::vector<int> findPlayers(const std::vector<AttributeThreshold>& thresholds) const;
+
+    private:
+        static std::uint8_t clampRating(int raw);
+
+        // Rows that passed every threshold so far get 1 in the mask; then collected into IDs
+        static std::vector<int> collectMatches(const std::vector<std::uint8_t>& mask);
+
+        std::vector<std::uint8_t> columns[AttributeCount];
+    };
+
+} // namespace BBEngine
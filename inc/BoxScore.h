@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
+#include <memory_resource>
 #include <cassert> // or <stdexcept>
 
 namespace BBEngine
@@ -49,19 +51,66 @@ namespace BBEngine
         // Add more stats if needed (pitch count, etc.)
     };
 
+    /**
+     * Just the team totals and the line score of a box score: enough to carry a game's score
+     * somewhere else. The line score is kept for the first LineScoreInnings innings; runs from
+     * later innings are added to the last column, so it still adds up to the runs.
+     */
+    struct BoxScoreTotals
+    {
+        static constexpr int LineScoreInnings = 12;
+
+        int homeRuns = 0;
+        int awayRuns = 0;
+        int homeHits = 0;
+        int awayHits = 0;
+        int homeErrors = 0;
+        int awayErrors = 0;
+
+        std::uint16_t innings = 0;                          // columns in the line score
+        std::uint8_t homeLineScore[LineScoreInnings] = {};
+        std::uint8_t awayLineScore[LineScoreInnings] = {};
+    };
+
     /**
      * BoxScore class for a single game, allowing incremental updates
      * as the game progresses. By the end, it can provide a final summary.
+     *
+     * Every player who appears gets a slot: the index of the player's line in the getXxxLines() vectors.
+     * Slots are handed out in order of appearance and never move, and the line storage is
+     * reserved up front (MaxBattersPerSide / MaxPitchersPerSide), so references to lines stay
+     * valid for the whole game. Copies get the same reserved storage (a GameReplay checkpoint
+     * or a seek() result is a copy, and keeps recording without moving lines). Callers that know a player's slot (GameManager registers its
+     * lineups before the first pitch) can use the ...InSlot methods and skip the lookup entirely;
+     * the Player* methods scan the side's lines for the player (at most MaxBattersPerSide pointers,
+     * contiguous, so it's as quick as hashing and never allocates).
+     *
+     * All storage comes from the memory resource given to the constructor (Season's pooled boxes
+     * use the season arena). Past construction a box only allocates when a game goes beyond the
+     * 12 innings its line score reserves. Copies use the default resource.
      */
     class BoxScore
     {
     public:
+        static constexpr int MaxBattersPerSide = 32;
+        static constexpr int MaxPitchersPerSide = 16;
+
         /**
          * Constructor with the names of home and away teams or references to actual Team objects.
          * For simplicity, we'll just store strings here.
          */
         BoxScore(const std::string& homeTeamName,
-            const std::string& awayTeamName);
+            const std::string& awayTeamName,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        /**
+         * Copies reserve the full capacity before taking the other box's lines; a defaulted
+         * copy would only allocate what's in use, and the next batter would move every line.
+         */
+        BoxScore(const BoxScore& other);
+        BoxScore& operator=(const BoxScore& other);
+        BoxScore(BoxScore&&) = default;
+        BoxScore& operator=(BoxScore&&) = default;
 
         // ----------------------
         // High-level Game Info
@@ -72,14 +121,47 @@ namespace BBEngine
         void setHomeTeamName(const std::string& name);
         void setAwayTeamName(const std::string& name);
 
+        /**
+         * Clear every line so the object can be reused for another game.
+         * The vectors keep their capacity, so a pooled BoxScore doesn't allocate from one game to the next.
+         */
+        void reset(const std::string& homeTeamName,
+            const std::string& awayTeamName);
+
+        /**
+         * Team runs/hits/errors in one go.
+         */
+        BoxScoreTotals getTotals() const;
+
+        /**
+         * Zero every line (players keep their slots) and start the team totals and the line
+         * score from 'totals' instead of 0; the current inning becomes the line score's last.
+         * From here on the lines hold only what happens next, while the totals and the line
+         * score stay the whole game's: that's how a game forked from a snapshot keeps the real
+         * score without copying anybody's line.
+         *
+         * Totals from past the LineScoreInnings-th inning have already folded the extra innings
+         * into the last column, and the split can't be recovered. Such a box keeps folding: its
+         * line score stays at LineScoreInnings columns and later runs go into the last one, so
+         * it reads exactly like the getTotals() of the game it came from.
+         */
+        void seedTotals(const BoxScoreTotals& totals);
+
         // -----------------------------------------------------
         // Methods to Manage Batting Lines (Lineup & Statistics)
         // -----------------------------------------------------
         /**
          * Add a batter to either the home or away lineup.
          * This will create a new BoxScoreBattingLine entry for that player.
+         * Returns the player's slot (the existing one if already in the lineup).
+         * Throws std::length_error if the side already has MaxBattersPerSide batters.
+         */
+        int addBatterToLineup(bool isHome, Player* player);
+
+        /**
+         * The slot of a batter's line, or -1 if the batter hasn't appeared.
          */
-        void addBatterToLineup(bool isHome, Player* player);
+        int getBattingSlot(bool isHome, Player* player) const;
 
         /**
          * Update hitting stats for a single at-bat or plate appearance.
@@ -96,6 +178,21 @@ namespace BBEngine
             int strikeouts = 0,
             int runsScored = 0);
 
+        /**
+         * Same as recordAtBat, for a slot returned by addBatterToLineup: no lookup at all.
+         */
+        void recordAtBatInSlot(bool isHome,
+            int slot,
+            int atBats = 1,
+            int hits = 0,
+            int doubles_ = 0,
+            int triples = 0,
+            int homeRuns = 0,
+            int runsBattedIn = 0,
+            int walks = 0,
+            int strikeouts = 0,
+            int runsScored = 0);
+
         // Convenience methods:
         void recordWalk(bool isHome, Player* batter);
         void recordStrikeout(bool isHome, Player* batter);
@@ -104,26 +201,65 @@ namespace BBEngine
             bool isTriple = false,
             bool isHomerun = false);
 
+        void recordWalkInSlot(bool isHome, int slot);
+        void recordStrikeoutInSlot(bool isHome, int slot);
+
         /**
          * Access to the lineups
          */
-        const std::vector<BoxScoreBattingLine>& getHomeBattingLines() const;
-        const std::vector<BoxScoreBattingLine>& getAwayBattingLines() const;
+        const std::pmr::vector<BoxScoreBattingLine>& getHomeBattingLines() const;
+        const std::pmr::vector<BoxScoreBattingLine>& getAwayBattingLines() const;
 
         /**
-         * Team run totals (just sums of runsScored if you prefer).
+         * Team run totals (the sum of runsScored). These are running totals kept up to date
+         * as lines change, so they're O(1) and fine to call after every half inning.
          */
         int getHomeTeamRuns() const;
         int getAwayTeamRuns() const;
 
+        int getHomeTeamHits() const;
+        int getAwayTeamHits() const;
+
+        // -------------------------------------------------------
+        // Innings & Line Score
+        // -------------------------------------------------------
+        /**
+         * Tell the box score which inning is being played, so runs land in the right column
+         * of the line score. GameManager calls this at the start of every half inning.
+         * Defaults to 1.
+         */
+        void setCurrentInning(int inning);
+        int getCurrentInning() const;
+
+        /**
+         * Charge an error to a team (isHome = the fielding team that made it).
+         */
+        void recordError(bool isHome, int count = 1);
+        int getHomeTeamErrors() const;
+        int getAwayTeamErrors() const;
+
+        /**
+         * Runs by inning: [0] is the 1st inning. Every inning that was started has a column,
+         * so a line score always adds up to the team's runs. (A box seeded from totals past
+         * the 12th stops at 12 columns; see seedTotals.)
+         */
+        const std::pmr::vector<int>& getHomeLineScore() const;
+        const std::pmr::vector<int>& getAwayLineScore() const;
+
         // -------------------------------------------------------
         // Methods to Manage Pitching Lines (Appearance & Updates)
         // -------------------------------------------------------
         /**
          * Add a pitcher for home or away side.
          * The next appearance is appended to the vector.
+         * Returns the pitcher's slot; throws std::length_error past MaxPitchersPerSide.
+         */
+        int addPitcher(bool isHome, Player* pitcher);
+
+        /**
+         * The slot of a pitcher's line, or -1 if the pitcher hasn't appeared.
          */
-        void addPitcher(bool isHome, Player* pitcher);
+        int getPitchingSlot(bool isHome, Player* pitcher) const;
 
         /**
          * Incrementally update a pitcher's stats, e.g., after an inning or partial inning.
@@ -137,6 +273,15 @@ namespace BBEngine
             int walksAllowed,
             int strikeouts);
 
+        void recordPitchingInSlot(bool isHome,
+            int slot,
+            double inningsPitchedDelta,
+            int hitsAllowed,
+            int runsAllowed,
+            int earnedRuns,
+            int walksAllowed,
+            int strikeouts);
+
         // Mark a pitcher with a decision if applicable (win, loss, save).
         void assignPitchingDecision(bool isHome,
             Player* pitcher,
@@ -145,28 +290,48 @@ namespace BBEngine
             bool save);
 
         // Access to pitching lines
-        const std::vector<BoxScorePitchingLine>& getHomePitchingLines() const;
-        const std::vector<BoxScorePitchingLine>& getAwayPitchingLines() const;
+        const std::pmr::vector<BoxScorePitchingLine>& getHomePitchingLines() const;
+        const std::pmr::vector<BoxScorePitchingLine>& getAwayPitchingLines() const;
 
     private:
-        // Helper to find (or create) a batting line for a given player (home or away).
-        BoxScoreBattingLine& findBattingLine(bool isHome, Player* player);
+        // Helper to find (or create) the batting slot for a given player (home or away).
+        int findBattingSlot(bool isHome, Player* player);
 
-        // Helper to find (or create) a pitching line for a given pitcher (home or away).
-        BoxScorePitchingLine& findPitchingLine(bool isHome, Player* pitcher);
+        // Helper to find (or create) the pitching slot for a given pitcher (home or away).
+        int findPitchingSlot(bool isHome, Player* pitcher);
 
     private:
         // Basic game info
         std::string homeTeam;
         std::string awayTeam;
 
-        // Offense
-        std::vector<BoxScoreBattingLine> homeBattingLines;
-        std::vector<BoxScoreBattingLine> awayBattingLines;
+        // Offense. Reserved to MaxBattersPerSide in the constructor and never grown past it.
+        std::pmr::vector<BoxScoreBattingLine> homeBattingLines;
+        std::pmr::vector<BoxScoreBattingLine> awayBattingLines;
+
+        // Pitching. Reserved to MaxPitchersPerSide.
+        std::pmr::vector<BoxScorePitchingLine> homePitchingLines;
+        std::pmr::vector<BoxScorePitchingLine> awayPitchingLines;
+
+        // Running totals, kept in step with the lines
+        // (not "homeRuns": that name is taken by the HR count parameters)
+        int homeTeamRuns;
+        int awayTeamRuns;
+        int homeTeamHits;
+        int awayTeamHits;
+        int homeTeamErrors;
+        int awayTeamErrors;
+
+        // Line score (runs per inning) and the inning new runs are credited to
+        std::pmr::vector<int> homeLineScore;
+        std::pmr::vector<int> awayLineScore;
+        int currentInning;
+
+        // Set by seedTotals() from folded totals: innings past LineScoreInnings share its last column
+        bool foldLineScore;
 
-        // Pitching
-        std::vector<BoxScorePitchingLine> homePitchingLines;
-        std::vector<BoxScorePitchingLine> awayPitchingLines;
+        // How many line score columns the current inning needs
+        int lineScoreColumns() const;
     };
 
 } // namespace BBEngine
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace BBEngine
+{
+    /**
+     * A counter-based random number generator (Philox4x32-10, Salmon et al., "Parallel Random
+     * Numbers: As Easy as 1, 2, 3"). Every output is a pure function of (key, counter), so there
+     * is no hidden sequential state: any position in any stream can be jumped to in O(1).
+     *
+     * We use it like this:
+     *  - key     = the simulation seed
+     *  - counter = (word block, pitch index, stream/game ID, domain)
+     *
+     * So every pitch of every game has its own independent stream, and re-simulating a game on a
+     * different thread (or replaying one pitch) gives bit-identical numbers. The domain keeps
+     * different users of the same seed apart: games use domain 0, and anything else that numbers
+     * its streams from 0 (e.g. SeasonProjection replicas) picks its own domain so stream r there
+     * never lines up with game r.
+     *
+     * The class also satisfies UniformRandomBitGenerator, so it plugs into <random> distributions.
+     * The whole state is 44 bytes, versus ~5 KB for std::mt19937.
+     */
+    class CounterRng
+    {
+    public:
+        using result_type = std::uint32_t;
+        using Block = std::array<std::uint32_t, 4>;
+
+        CounterRng()
+            : key{ 0, 0 }, counter{ 0, 0, 0, 0 }, buffer{ 0, 0, 0, 0 }, bufferIndex(4)
+        {
+        }
+
+        explicit CounterRng(std::uint64_t seed, std::uint32_t stream = 0)
+            : CounterRng()
+        {
+            setSeed(seed);
+            setStream(stream);
+        }
+
+        // ----------------------------------------------------
+        // Positioning
+        // ----------------------------------------------------
+        /**
+         * The seed is the Philox key. Changing it resets the position inside the current pitch.
+         */
+        void setSeed(std::uint64_t seed)
+        {
+            key[0] = static_cast<std::uint32_t>(seed);
+            key[1] = static_cast<std::uint32_t>(seed >> 32);
+            bufferIndex = 4;
+        }
+
+        std::uint64_t getSeed() const
+        {
+            return (static_cast<std::uint64_t>(key[1]) << 32) | key[0];
+        }
+
+        /**
+         * Select an independent stream, e.g. the gameID.
+         */
+        void setStream(std::uint32_t stream)
+        {
+            counter[2] = stream;
+            bufferIndex = 4;
+        }
+
+        std::uint32_t getStream() const { return counter[2]; }
+
+        /**
+         * Select a domain (the top counter word); see the class comment. Defaults to 0.
+         */
+        void setDomain(std::uint32_t domain)
+        {
+            counter[3] = domain;
+            bufferIndex = 4;
+        }
+
+        std::uint32_t getDomain() const { return counter[3]; }
+
+        /**
+         * Jump to the first word of a pitch's stream.
+         */
+        void seekPitch(std::uint32_t pitchIndex)
+        {
+            counter[0] = 0;
+            counter[1] = pitchIndex;
+            bufferIndex = 4;
+        }
+
+        std::uint32_t getPitchIndex() const { return counter[1]; }
+
+        // ----------------------------------------------------
+        // UniformRandomBitGenerator interface
+        // ----------------------------------------------------
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+        result_type operator()()
+        {
+            if (bufferIndex == 4)
+            {
+                buffer = generate(counter, key);
+                counter[0]++; // next block within the same pitch
+                bufferIndex = 0;
+            }
+            return buffer[bufferIndex++];
+        }
+
+        /**
+         * Map a 32-bit word to a double in [0, 1). Defined here rather than via
+         * std::uniform_real_distribution so results don't depend on the standard library.
+         */
+        static double toUnit(result_type word)
+        {
+            return word * (1.0 / 4294967296.0);
+        }
+
+        // ----------------------------------------------------
+        // The raw bijection
+        // ----------------------------------------------------
+        /**
+         * Philox4x32 with 10 rounds: maps a 128-bit counter and 64-bit key to 128 random bits.
+         */
+        static Block generate(const Block& ctr, const std::array<std::uint32_t, 2>& k)
+        {
+            return generate(ctr[0], ctr[1], ctr[2], ctr[3], k[0], k[1]);
+        }
+
+        static Block generate(std::uint32_t c0, std::uint32_t c1, std::uint32_t c2, std::uint32_t c3,
+            std::uint32_t k0, std::uint32_t k1)
+        {
+            for (int round = 0; round < 10; ++round)
+            {
+                if (round > 0)
+                {
+                    k0 += 0x9E3779B9u;
+                    k1 += 0xBB67AE85u;
+                }
+                const std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * c0;
+                const std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * c2;
+                const std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32);
+                const std::uint32_t lo0 = static_cast<std::uint32_t>(p0);
+                const std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32);
+                const std::uint32_t lo1 = static_cast<std::uint32_t>(p1);
+
+                c0 = hi1 ^ c1 ^ k0;
+                c2 = hi0 ^ c3 ^ k1;
+                c1 = lo1;
+                c3 = lo0;
+            }
+            return Block{ c0, c1, c2, c3 };
+        }
+
+        const std::array<std::uint32_t, 2>& getKey() const { return key; }
+
+        bool operator==(const CounterRng& other) const
+        {
+            return key == other.key && counter == other.counter
+                && bufferIndex == other.bufferIndex;
+        }
+        bool operator!=(const CounterRng& other) const { return !(*this == other); }
+
+    private:
+        std::array<std::uint32_t, 2> key;
+        Block counter;          ///< (block, pitch, stream, domain); block is the *next* block to generate
+        Block buffer;           ///< words from the last generated block
+        std::uint32_t bufferIndex; ///< next unread word in 'buffer'; 4 = empty
+    };
+
+} // namespace BBEngine
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Simulator.h"
+
+namespace BBEngine
+{
+    /**
+     * One pitch of play-by-play, 8 bytes. The situation fields are as they stood *before*
+     * the pitch; the result is what the pitch did.
+     */
+    struct PitchEvent
+    {
+        static constexpr std::uint8_t BottomHalf = 1 << 0;   // bit 0 of 'flags'
+        static constexpr std::uint8_t NotInPlay = 0x0F;      // high nibble of 'result'
+
+        std::uint16_t inning;
+        std::uint8_t  outs;     // 0..2
+        std::uint8_t  bases;    // GameState bit mask
+        std::uint8_t  batter;   // lineup spot (0-based) of the batting side
+        std::uint8_t  flags;    // bit 0: bottom half; bits 1..7: pitch number in the plate appearance (1-based)
+        std::uint8_t  result;   // low nibble: PitchOutcome; high nibble: BattedBallOutcome or NotInPlay
+        std::uint8_t  runs;     // runs that scored on the pitch
+
+        bool isBottom() const { return (flags & BottomHalf) != 0; }
+        int getPitchOfPlateAppearance() const { return flags >> 1; }
+
+        PitchOutcome getPitchOutcome() const { return static_cast<PitchOutcome>(result & 0x0F); }
+        bool isInPlay() const { return (result >> 4) != NotInPlay; }
+        BattedBallOutcome getBattedBallOutcome() const { return static_cast<BattedBallOutcome>(result >> 4); }
+    };
+
+    static_assert(sizeof(PitchEvent) == 8, "PitchEvent should be 8 bytes");
+
+    /**
+     * A game's pitch-by-pitch record, for replays, win probability and the like.
+     *
+     * Hand one to GameManager::setEventLog() and runGame() appends a PitchEvent per pitch.
+     * Like a BoxScore it's meant to be reused: clear() keeps the buffer, so after the first
+     * game (or an up-front reserve()) recording is a store into memory that's already there.
+     */
+    class GameEventLog
+    {
+    public:
+        // Room for a long game without reallocating
+        static constexpr std::size_t DefaultCapacity = 512;
+
+        explicit GameEventLog(std::size_t capacity = DefaultCapacity);
+
+        /**
+         * Forget the events (not the buffer) and tag the log with the next game's ID.
+         */
+        void clear(int gameID = -1);
+        void reserve(std::size_t capacity);
+
+        int getGameID() const;
+        std::size_t size() const;
+        bool empty() const;
+        std::size_t getBytes() const;
+
+        const PitchEvent& operator[](std::size_t i) const { return events[i]; }
+        const PitchEvent* begin() const { return events.data(); }
+        const PitchEvent* end() const { return events.data() + events.size(); }
+        const std::vector<PitchEvent>& getEvents() const;
+
+        /**
+         * Record one pitch; GameManager calls this. The pitch number within the plate
+         * appearance is worked out here (a pitch after a foul to the same batter continues it).
+         * 'battedBall' is only read when 'outcome' is BATTED_BALL_IN_PLAY.
+         */
+        void append(std::uint16_t inning, std::uint8_t outs, std::uint8_t bases, std::uint8_t batter,
+            bool bottom, PitchOutcome outcome, BattedBallOutcome battedBall, int runs)
+        {
+            std::uint8_t pitchNumber = 1;
+            if (!events.empty())
+            {
+                const PitchEvent& last = events.back();
+                if (last.getPitchOutcome() == PitchOutcome::FOUL && last.isBottom() == bottom
+                    && last.inning == inning && last.batter == batter)
+                {
+                    const int next = last.getPitchOfPlateAppearance() + 1;
+                    pitchNumber = static_cast<std::uint8_t>(next > 127 ? 127 : next);
+                }
+            }
+
+            PitchEvent e;
+            e.inning = inning;
+            e.outs = outs;
+            e.bases = bases;
+            e.batter = batter;
+            e.flags = static_cast<std::uint8_t>((pitchNumber << 1) | (bottom ? PitchEvent::BottomHalf : 0));
+            const std::uint8_t inPlay = outcome == PitchOutcome::BATTED_BALL_IN_PLAY
+                ? static_cast<std::uint8_t>(battedBall) : PitchEvent::NotInPlay;
+            e.result = static_cast<std::uint8_t>((inPlay << 4) | static_cast<std::uint8_t>(outcome));
+            e.runs = static_cast<std::uint8_t>(runs);
+            events.push_back(e);
+        }
+
+    private:
+        std::vector<PitchEvent> events;
+        int gameID;
+    };
+
+} // namespace BBEngine
@@ -1,12 +1,59 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
+#include <cstdint>
 #include "Team.h"
 #include "BoxScore.h"
 #include "Simulator.h"
+#include "GameEventLog.h"
 
 namespace BBEngine
 {
+    /**
+     * Everything about a game that changes from pitch to pitch, packed into 8 bytes.
+     */
+    struct GameState
+    {
+        // Bits of 'bases'
+        static constexpr std::uint8_t FirstBase = 1 << 0;
+        static constexpr std::uint8_t SecondBase = 1 << 1;
+        static constexpr std::uint8_t ThirdBase = 1 << 2;
+
+        std::uint16_t inning;         // starts at 1
+        std::uint8_t  outs;           // 0..3
+        std::uint8_t  bases;          // 3-bit mask of occupied bases
+        std::uint8_t  batterIndex[2]; // next batter in each lineup: [0] = away, [1] = home
+        bool topOfInning;             // true => away batting, false => home batting
+        bool gameOver;
+
+        GameState()
+            : inning(1), outs(0), bases(0), batterIndex{ 0, 0 }, topOfInning(true), gameOver(false)
+        {
+        }
+    };
+
+    /**
+     * Everything needed to carry on a game from where it stands, as a 96-byte value:
+     * the situation, the score and line score, who's pitching, and where the random stream is.
+     *
+     * Restoring one (GameManager::restoreSnapshot) into a fresh GameManager, BoxScore and
+     * Simulator forks the game; the original is never touched, so any number of forks can
+     * run side by side. A fork's BoxScore lines only hold what happens after the fork; its
+     * totals and line score are the whole game's.
+     * Restored as is, a fork plays out exactly like the original; give it another rngStream
+     * for a different "what if".
+     */
+    struct GameSnapshot
+    {
+        GameState state;
+        BoxScoreTotals totals;
+        Player* pitchers[2] = { nullptr, nullptr };   // on the mound: [0] = away, [1] = home
+        std::uint64_t rngSeed = 0;
+        std::uint32_t rngStream = 0;
+        std::uint32_t pitchIndex = 0;                 // the next pitch's index
+    };
+
     /**
      * The GameManager class orchestrates a single baseball game.
      * It handles:
@@ -26,29 +73,118 @@ namespace BBEngine
          */
         GameManager(Team* home, Team* away, BoxScore* box, Simulator* sim);
 
+        /**
+         * The constructor resolves both lineups (vs RHP) and both teams' current starters into
+         * flat arrays of ratings, so the per-pitch loop never walks Team -> Player -> PlayerAttributes.
+         * It also registers both lineups with the BoxScore, so every batter has a line (and a slot)
+         * before the first pitch and recording a result needs no lookup.
+         * If you change a lineup or rotation after constructing the GameManager, call refreshLineups().
+         */
+        void refreshLineups();
+
+        /**
+         * Bring in a new pitcher for one side. Only that pitcher is re-resolved.
+         */
+        void changePitcher(bool home, Player* newPitcher);
+        Player* getCurrentPitcher(bool home) const;
+
+        /**
+         * Put 'newBatter' in a lineup spot (0-based) for the rest of this game, e.g. a pinch
+         * hitter in one fork of a snapshot. Only that spot is re-resolved and the BoxScore gives
+         * the newcomer a line; the Team and its lineup are never touched, so forks of the same
+         * game can substitute differently side by side. Substitutions aren't part of a snapshot.
+         * Throws std::out_of_range for a spot past the lineup.
+         */
+        void substituteBatter(bool home, int spot, Player* newBatter);
+        Player* getBatter(bool home, int spot) const;
+
         /**
          * Main method to run the entire game until a winner is decided (or 9+ innings).
          */
         void runGame();
 
+        /**
+         * Or one pitch at a time: plays the next pitch exactly as runGame() would (closing out
+         * the half-inning on the third out) and returns false once the game is over.
+         * Mix freely with runGame(), which carries on from wherever the game is.
+         */
+        bool playPitch();
+
         // Accessors for final results or status
         bool isGameOver() const;
 
         int  getCurrentInning() const;
         bool isTopOfInning() const;
+        const GameState& getState() const;
+
+        /**
+         * Put the game in a given situation (e.g. a replay checkpoint). The BoxScore isn't touched.
+         * The game can stop and resume mid half-inning: runGame() only clears the outs and
+         * runners when the previous half-inning is over.
+         */
+        void setState(const GameState& state);
+
+        /**
+         * Capture the game as it stands (between pitches), or continue from a capture. Restoring
+         * sets the state, the pitchers, the Simulator's stream and pitch index, and seeds this
+         * game's BoxScore with the snapshot's totals and line score (see BoxScore::seedTotals). Then runGame()
+         * carries on from there.
+         */
+        GameSnapshot takeSnapshot() const;
+        void restoreSnapshot(const GameSnapshot& snapshot);
+
+        /**
+         * Record every pitch of runGame() into 'log' (nullptr => don't record, the default).
+         * The log is appended to, not cleared. runGame() picks a recording or a non-recording
+         * loop once up front, so a game without a log pays nothing for the feature.
+         */
+        void setEventLog(GameEventLog* log);
+        GameEventLog* getEventLog() const;
+
+        /**
+         * Play recorded pitches instead of simulating them: log[first], log[first + 1], ... go
+         * through the same half-inning logic as runGame(), updating the state and the BoxScore,
+         * and the Simulator is never called. Stops when the game ends or before log[last];
+         * stopping on a half-inning boundary leaves the game at the start of the next half.
+         *
+         * Replaying starts from the situation log[first] was pitched in (a fresh GameManager for
+         * log[0]). Throws std::runtime_error if an event doesn't match the situation (wrong game,
+         * different lineups). Returns the next event's index.
+         */
+        std::size_t replayGame(const GameEventLog& log, std::size_t first = 0, std::size_t last = SIZE_MAX);
+
+        /**
+         * Longest lineup the resolved roster can hold.
+         */
+        static constexpr int MaxLineupSize = 16;
 
     private:
+        // runGame(), compiled with and without event recording
+        template<bool Record>
+        void playGame();
+
         /**
          * Runs a half-inning of baseball: from 0 outs until 3 outs or other end condition.
          */
+        template<bool Record>
         void runHalfInning();
 
         /**
          * Perform a single pitch, calling the simulator.
          * If the pitch ends the at-bat (hit, walk, out), break from that at-bat loop.
          */
+        template<bool Record>
         void proceedPitch();
 
+        // After the last out of a half-inning: game over?, then on to the next half if there is one
+        void finishHalfInning();
+
+        // Everything a pitch does once its outcome is known: runners, outs, BoxScore, next batter
+        void applyPitch(PitchOutcome outcome, BattedBallOutcome hitResult);
+
+        // One pitch of replayGame(), checked against the current situation
+        void replayPitch(const PitchEvent& e);
+
         /**
          * Check if the game should end now (walk-off, or after 9 innings).
          * If ended, set gameOver = true.
@@ -56,7 +192,8 @@ namespace BBEngine
         void checkGameOver();
 
         /**
-         * Resets outs to 0, possibly resets base runners if needed (between half-innings).
+         * Resets outs to 0 and clears the bases if the last half-inning is over
+         * (a game restored mid-inning keeps both).
          */
         void startHalfInning();
 
@@ -66,28 +203,46 @@ namespace BBEngine
         void endHalfInning();
 
         // Helper for basic base running. Extremely naive: single always moves each runner up one base, etc.
-        void handleBattedBall(BattedBallOutcome outcome, bool isHome, Player* batter, Player* pitcher);
+        // The batter is identified by the BoxScore slot of the batting line.
+        void handleBattedBall(BattedBallOutcome outcome, bool isHome, int batterSlot, Player* pitcher);
+
+        // One lineup spot, resolved
+        struct LineupSlot
+        {
+            Player* player;
+            int boxSlot;          // this batter's line in the BoxScore
+            BatterRatings ratings;
+            bool hasAttributes;
+        };
+
+        // One team's side of the game, resolved: its lineup and the pitcher it has on the mound
+        struct ResolvedSide
+        {
+            Player* pitcher;
+            PitcherRatings pitcherRatings;
+            bool pitcherHasAttributes;
+            std::uint8_t lineupSize;   // 0 => no usable lineup
+            LineupSlot lineup[MaxLineupSize];
+        };
+
+        // Helper: fill 'side' from the team's current lineup and starter
+        void resolveSide(ResolvedSide& side, Team* team, bool home);
+
+        // Helper: fill one lineup spot for 'player' (who gets a BoxScore line)
+        void resolveBatter(LineupSlot& slot, Player* player, bool home);
 
         // Data members
         Team* homeTeam;
         Team* awayTeam;
         BoxScore* boxScore;
         Simulator* simulator;
+        GameEventLog* eventLog;
 
         // Game state
-        int  inning;        // starts at 1
-        bool topOfInning;   // true => away batting, false => home batting
-        int  outs;          // 0..3
-        bool gameOver;
-
-        // Simple base runner flags for first, second, third
-        bool runnerOnFirst;
-        bool runnerOnSecond;
-        bool runnerOnThird;
+        GameState state;
 
-        // Track the next batter index for each team
-        int homeBatterIndex;
-        int awayBatterIndex;
+        // [0] = away, [1] = home
+        ResolvedSide sides[2];
     };
 
 } // namespace BBEngine
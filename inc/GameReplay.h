@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Team.h"
+#include "BoxScore.h"
+#include "GameEventLog.h"
+#include "GameManager.h"
+
+namespace BBEngine
+{
+    /**
+     * Re-derives a recorded game from its GameEventLog, without the Simulator (so no RNG state
+     * is needed): the whole box score, or the game as it stood at the start of any half-inning.
+     *
+     * The constructor replays the log once and keeps a checkpoint (GameState + BoxScore) at the
+     * start of every 'checkpointInterval'-th half-inning. seek() copies the nearest checkpoint at
+     * or before the target and replays at most checkpointInterval - 1 half-innings from there;
+     * with the default interval of 1 it's just the copy.
+     *
+     * The teams must have the lineups they had when the game was played. The log and the teams
+     * are borrowed and must outlive the replay.
+     */
+    class GameReplay
+    {
+    public:
+        GameReplay(Team* home, Team* away, const GameEventLog& log, int checkpointInterval = 1);
+
+        /**
+         * Half-innings in the log: top 1st = 0, bottom 1st = 1, ...
+         */
+        int getHalfInningCount() const;
+        std::size_t getCheckpointCount() const;
+        int getCheckpointInterval() const;
+
+        /**
+         * Index of the first pitch of a half-inning. Throws std::out_of_range if the game
+         * never got there.
+         */
+        std::size_t getFirstEvent(int inning, bool bottom) const;
+
+        /**
+         * The whole game: 'box' is reset and refilled; returns the final state.
+         */
+        GameState replay(BoxScore& box) const;
+
+        /**
+         * The game before the first pitch of the given half-inning ("bottom of the 7th"):
+         * 'box' holds the box score as of then. Throws std::out_of_range if the game never
+         * got there.
+         */
+        GameState seek(int inning, bool bottom, BoxScore& box) const;
+
+    private:
+        struct Checkpoint
+        {
+            std::size_t firstEvent;
+            GameState state;
+            BoxScore box;
+        };
+
+        int halfIndex(int inning, bool bottom) const;
+
+        Team* homeTeam;
+        Team* awayTeam;
+        const GameEventLog* log;
+        int interval;
+
+        // First event of each half-inning, in order
+        std::vector<std::size_t> halfStarts;
+
+        // checkpoints[k] = the start of half-inning k * interval
+        std::vector<Checkpoint> checkpoints;
+    };
+
+} // namespace BBEngine
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <set>
+#include <utility>
+#include <vector>
+#include "StatRegistry.h"
+
+namespace BBEngine
+{
+    /**
+     * A leaderboard that stays sorted as values change: every player's current value sits in an
+     * ordered set, so moving one player after a game is an erase + insert, O(log n), and reading
+     * the top N is a walk over the first N entries.
+     *
+     * Players are identified by their StatsManager ID. Equal values are ordered by ID (lowest
+     * first) so the board is deterministic and matches StatsManager::getLeaders().
+     *
+     * StatsManager owns these (see StatsManager::subscribeLeaderboard()); you normally don't
+     * build one yourself.
+     */
+    class Leaderboard
+    {
+    public:
+        Leaderboard(StatId stat, bool ascending);
+
+        StatId getStat() const;
+        bool isAscending() const;
+
+        /**
+         * Insert a player, or move it to its new value.
+         */
+        void update(int playerID, double value);
+
+        /**
+         * Take a player off the board (no-op if not on it).
+         */
+        void remove(int playerID);
+
+        bool contains(int playerID) const;
+        double getValue(int playerID) const;
+        std::size_t size() const;
+
+        /**
+         * The best 'n' entries as (player ID, value), best first.
+         */
+        std::vector<std::pair<int, double>> top(int n) const;
+
+        /**
+         * True if (valueA, idA) ranks ahead of (valueB, idB) in this order.
+         */
+        static bool ranksAhead(double valueA, int idA, double valueB, int idB, bool ascending);
+
+    private:
+        struct Entry
+        {
+            double value;
+            int id;
+        };
+
+        struct Order
+        {
+            bool ascending;
+            bool operator()(const Entry& a, const Entry& b) const
+            {
+                return ranksAhead(a.value, a.id, b.value, b.id, ascending);
+            }
+        };
+
+        StatId stat;
+        bool ascending;
+        std::set<Entry, Order> ordered;
+
+        // Current value per player ID, so update() can find the old entry
+        std::vector<double> values;
+        std::vector<bool> present;
+    };
+
+} // namespace BBEngine
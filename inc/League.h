@@ -4,10 +4,22 @@
 #include <string>
 #include "Team.h"
 #include "Season.h"
+#include "SeasonArena.h"
 // If you have manager classes, e.g. #include "StatsManager.h"
 
 namespace BBEngine
 {
+    /**
+     * What we keep of a finished season once its Season/Schedule/Standings are gone:
+     * the final standings and a couple of totals. A few hundred bytes per season.
+     */
+    struct SeasonSummary
+    {
+        int seasonNumber = 0;                // 1 = the league's first season
+        int gamesPlayed = 0;
+        std::vector<TeamRecord> finalStandings; // best record first
+    };
+
     class League
     {
     public:
@@ -42,7 +54,9 @@ namespace BBEngine
         void advanceOneDay();
 
         /**
-         * If the current season is done, finalize it (move to pastSeasons, etc.)
+         * If the current season is done, finalize it and archive it: its final standings go into
+         * a SeasonSummary, and the season's Schedule, Standings and Season (all allocated from the
+         * season arena) are freed in one bulk release. Any Season* you held is invalid afterwards.
          */
         void finishSeason();
 
@@ -50,7 +64,12 @@ namespace BBEngine
          * Accessors
          */
         Season* getCurrentSeason() const;
-        const std::vector<Season*>& getPastSeasons() const;
+        const std::vector<SeasonSummary>& getPastSeasons() const;
+
+        /**
+         * The arena the current season lives in (for diagnostics, e.g. memory use per season).
+         */
+        const SeasonArena& getSeasonArena() const;
 
         // If you have manager references, e.g. StatsManager* getStatsManager()...
 
@@ -66,11 +85,14 @@ namespace BBEngine
         // The set of all teams in the league. Could subdivide by level if you want.
         std::vector<Team*> allTeams;
 
-        // The current active season
+        // Everything that belongs to the current season is allocated here and released in bulk
+        SeasonArena seasonArena;
+
+        // The current active season (lives in seasonArena)
         Season* currentSeason;
 
         // Archive of finished seasons
-        std::vector<Season*> pastSeasons;
+        std::vector<SeasonSummary> pastSeasons;
 
         // If you have manager references:
         // StatsManager* statsManager;
@@ -82,5 +104,8 @@ namespace BBEngine
 
         // Helper to check if currentSeason is not null
         bool hasActiveSeason() const;
+
+        // Helper: summarize the current season, then free it
+        void archiveCurrentSeason();
     };
 }
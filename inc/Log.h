@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace BBEngine
+{
+    enum class LogLevel : std::uint8_t
+    {
+        Trace,      // per pitch / per play; compiled out unless BBENGINE_ENABLE_TRACE is set
+        Debug,      // per day / per game
+        Info,       // season milestones, transactions
+        Warning,    // bad input that was ignored
+        Error,      // something the engine couldn't recover from (e.g. a game with no lineup)
+        Off
+    };
+
+    const char* toString(LogLevel level);
+
+    /**
+     * Where log messages go. write() can be called from any simulation thread at once,
+     * so a sink has to be thread-safe.
+     */
+    class LogSink
+    {
+    public:
+        virtual ~LogSink() = default;
+        virtual void write(LogLevel level, const std::string& message) = 0;
+    };
+
+    /**
+     * Engine-wide logging. There is no sink by default, so the engine is silent: a disabled
+     * message costs one atomic load, and its text is never even formatted (see BB_LOG below).
+     *
+     * The sink is borrowed, not owned; it must outlive its installation (setSink(nullptr) first).
+     */
+    namespace Log
+    {
+        void setSink(LogSink* sink);
+        LogSink* getSink();
+
+        // Messages below this level are dropped (default Info)
+        void setLevel(LogLevel level);
+        LogLevel getLevel();
+
+        // True if a message at 'level' would go anywhere
+        bool isEnabled(LogLevel level);
+
+        void write(LogLevel level, const std::string& message);
+    }
+
+    /**
+     * Writes "[Level] message" lines to a stream, one at a time. Handy for tools and tests;
+     * it locks, so keep it out of multi-threaded batch runs (use RingBufferSink there).
+     */
+    class StreamSink : public LogSink
+    {
+    public:
+        explicit StreamSink(std::ostream& out);
+        void write(LogLevel level, const std::string& message) override;
+
+    private:
+        std::ostream& out;
+        std::mutex mutex;
+    };
+
+    /**
+     * One buffered message. Long messages are truncated to fit.
+     */
+    struct LogRecord
+    {
+        static constexpr std::size_t MaxLength = 118;
+
+        LogLevel level = LogLevel::Info;
+        std::uint8_t length = 0;
+        char text[MaxLength];
+
+        std::string getText() const { return std::string(text, length); }
+    };
+
+    /**
+     * A lock-free bounded queue of LogRecords (a per-slot sequence number ring), for async
+     * logging from simulation threads: write() claims a slot with one compare-exchange and
+     * copies the text in; it never blocks and never allocates. When the ring is full the
+     * message is dropped and counted rather than waiting for the reader.
+     *
+     * Some other thread (or the same one, between days) calls drain() to empty it.
+     */
+    class RingBufferSink : public LogSink
+    {
+    public:
+        /**
+         * capacity is rounded up to a power of two (minimum 2).
+         */
+        explicit RingBufferSink(std::size_t capacity = 4096);
+
+        RingBufferSink(const RingBufferSink&) = delete;
+        RingBufferSink& operator=(const RingBufferSink&) = delete;
+
+        void write(LogLevel level, const std::string& message) override;
+
+        /**
+         * Take the oldest record; false if the ring is empty.
+         */
+        bool pop(LogRecord& out);
+
+        /**
+         * Pop everything into 'target' (e.g. a StreamSink), oldest first. Returns the count.
+         */
+        std::size_t drain(LogSink& target);
+
+        std::size_t getCapacity() const;
+
+        // Messages lost because the ring was full
+        std::uint64_t getDroppedCount() const;
+
+    private:
+        struct Slot
+        {
+            std::atomic<std::size_t> sequence;
+            LogRecord record;
+        };
+
+        std::unique_ptr<Slot[]> slots;
+        std::size_t mask;
+
+        // Producers and the consumer each get their own cache line
+        alignas(64) std::atomic<std::size_t> writePos;
+        alignas(64) std::atomic<std::size_t> readPos;
+        alignas(64) std::atomic<std::uint64_t> dropped;
+    };
+
+} // namespace BBEngine
+
+/**
+ * BB_LOG_INFO("Traded " << player->getName());
+ *
+ * The stream expression is only evaluated when the level is enabled and a sink is installed.
+ * BB_LOG_TRACE expands to nothing at all unless BBENGINE_ENABLE_TRACE is defined
+ * (cmake -DBBENGINE_ENABLE_TRACE=ON), so per-pitch logging is free in normal builds.
+ */
+#define BB_LOG(level, stream)                                           \
+    do                                                                  \
+    {                                                                   \
+        if (::BBEngine::Log::isEnabled(level))                          \
+        {                                                               \
+            std::ostringstream bbLogStream;                             \
+            bbLogStream << stream;                                      \
+            ::BBEngine::Log::write(level, bbLogStream.str());           \
+        }                                                               \
+    } while (0)
+
+#if defined(BBENGINE_ENABLE_TRACE)
+#define BB_LOG_TRACE(stream) BB_LOG(::BBEngine::LogLevel::Trace, stream)
+#else
+#define BB_LOG_TRACE(stream) do { } while (0)
+#endif
+
+#define BB_LOG_DEBUG(stream) BB_LOG(::BBEngine::LogLevel::Debug, stream)
+#define BB_LOG_INFO(stream) BB_LOG(::BBEngine::LogLevel::Info, stream)
+#define BB_LOG_WARNING(stream) BB_LOG(::BBEngine::LogLevel::Warning, stream)
+#define BB_LOG_ERROR(stream) BB_LOG(::BBEngine::LogLevel::Error, stream)
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace BBEngine
+{
+    // Ratings run 1..99; tables are indexed 0..99 so a rating can be used as an index directly.
+    constexpr int RatingCount = 100;
+
+    /**
+     * The probability formulas the Simulator uses out of the box.
+     *
+     * A formula type provides:
+     *  - PitcherKeyCount and pitcherKey(control, velocity): collapses the pitcher's ratings into
+     *    a single key in [0, PitcherKeyCount). The stock strike formula only depends on
+     *    control + 0.5 * velocity, so 2 * control + velocity is enough and keeps the table small.
+     *  - strikeProbability(pitcherKey, discipline, pitchOut) and contactProbability(contact),
+     *    both constexpr so a table can be built at compile time.
+     */
+    struct DefaultMatchupFormula
+    {
+        static constexpr int PitcherKeyCount = 3 * (RatingCount - 1) + 1;
+
+        static constexpr int pitcherKey(int control, int velocity)
+        {
+            return 2 * control + velocity;
+        }
+
+        static constexpr double strikeProbability(int pitcherKey, int discipline, bool pitchOut)
+        {
+            // (control + 0.5 * velocity) / 150 - discipline / 300, minus 0.2 on a pitch-out.
+            // pitcherKey * 0.5 is exactly control + 0.5 * velocity, so this matches the old
+            // per-pitch math bit for bit.
+            double base = (pitcherKey * 0.5) / 150.0;
+            base -= (discipline / 300.0);
+
+            if (pitchOut)
+            {
+                base -= 0.2;
+            }
+
+            if (base < 0.0) base = 0.0;
+            if (base > 1.0) base = 1.0;
+            return base;
+        }
+
+        static constexpr double contactProbability(int contact)
+        {
+            double base = contact / 100.0;
+            if (base < 0.0) base = 0.0;
+            if (base > 1.0) base = 1.0;
+            return base;
+        }
+    };
+
+    /**
+     * A non-owning, formula-agnostic handle to a MatchupTable.
+     * This is what the Simulator stores, so it can use tables built for any formula.
+     */
+    struct MatchupTableView
+    {
+        const std::uint16_t* pitcherKeys = nullptr; ///< [control * RatingCount + velocity]
+        const double* strike = nullptr;             ///< [(key * RatingCount + discipline) * 2 + pitchOut]
+        const double* contact = nullptr;            ///< [contact]
+
+        double strikeProbability(int control, int velocity, int discipline, bool pitchOut) const
+        {
+            const int key = pitcherKeys[control * RatingCount + velocity];
+            return strike[(key * RatingCount + discipline) * 2 + (pitchOut ? 1 : 0)];
+        }
+
+        double contactProbability(int contactRating) const
+        {
+            return contact[contactRating];
+        }
+    };
+
+    /**
+     * Precomputed strike and contact probabilities for every rating combination.
+     *
+     * The constructor is constexpr, so a table for a custom formula can be baked in at compile time:
+     *
+     *     static constexpr MatchupTable<MyFormula> myTable{};
+     *     simulator.setMatchupTable(myTable.view());
+     *
+     * The default table is large (about 480 KB), so it is built once at startup instead;
+     * see defaultMatchupTable().
+     */
+    template <typename Formula = DefaultMatchupFormula>
+    class MatchupTable
+    {
+    public:
+        constexpr MatchupTable()
+            : pitcherKeys{}, strike{}, contact{}
+        {
+            for (int control = 0; control < RatingCount; ++control)
+            {
+                for (int velocity = 0; velocity < RatingCount; ++velocity)
+                {
+                    pitcherKeys[control * RatingCount + velocity] =
+                        static_cast<std::uint16_t>(Formula::pitcherKey(control, velocity));
+                }
+            }
+
+            for (int key = 0; key < Formula::PitcherKeyCount; ++key)
+            {
+                for (int discipline = 0; discipline < RatingCount; ++discipline)
+                {
+                    const int slot = (key * RatingCount + discipline) * 2;
+                    strike[slot] = Formula::strikeProbability(key, discipline, false);
+                    strike[slot + 1] = Formula::strikeProbability(key, discipline, true);
+                }
+            }
+
+            for (int c = 0; c < RatingCount; ++c)
+            {
+                contact[c] = Formula::contactProbability(c);
+            }
+        }
+
+        constexpr double strikeProbability(int control, int velocity, int discipline, bool pitchOut) const
+        {
+            const int key = pitcherKeys[control * RatingCount + velocity];
+            return strike[(key * RatingCount + discipline) * 2 + (pitchOut ? 1 : 0)];
+        }
+
+        constexpr double contactProbability(int contactRating) const
+        {
+            return contact[contactRating];
+        }
+
+        MatchupTableView view() const
+        {
+            MatchupTableView v;
+            v.pitcherKeys = pitcherKeys.data();
+            v.strike = strike.data();
+            v.contact = contact.data();
+            return v;
+        }
+
+    private:
+        std::array<std::uint16_t, RatingCount * RatingCount> pitcherKeys;
+        std::array<double, Formula::PitcherKeyCount * RatingCount * 2> strike;
+        std::array<double, RatingCount> contact;
+    };
+
+    /**
+     * The shared table for DefaultMatchupFormula, built on first use.
+     */
+    const MatchupTable<DefaultMatchupFormula>& defaultMatchupTable();
+
+} // namespace BBEngine
@@ -2,13 +2,20 @@
 #pragma once
 
 #include <algorithm> // for std::clamp
+#include <cstdint>
 #include <vector>
+#include "AttributeTable.h"
 
 namespace BBEngine
 {
     /**
      * The PlayerAttributes class stores all skill ratings (199)
      * for batting, pitching, fielding, and baserunning.
+     *
+     * By default it keeps its own ratings. Bound to an AttributeTable (bindToTable()), it becomes
+     * a view over that player's row instead: every getter/setter reads or writes the table, so the
+     * per-player API and the league-wide bulk operations see the same numbers. Copying a bound
+     * PlayerAttributes copies the view, not the ratings.
      */
     class PlayerAttributes
     {
@@ -21,6 +28,11 @@ namespace BBEngine
          */
         PlayerAttributes();
 
+        /**
+         * A view over an existing row of 'table' (see AttributeTable).
+         */
+        PlayerAttributes(AttributeTable& table, int playerID);
+
         // ----------------------------------------------------------------
         // Getters & Setters - Hitting Attributes
         // ----------------------------------------------------------------
@@ -110,42 +122,47 @@ namespace BBEngine
          */
         void ageOneYear();
 
-    private:
-        // Helper to clamp a given value into [1..99].
-        int clampValue(int raw);
+        // ----------------------------------------------------------------
+        // Generic access & AttributeTable binding
+        // ----------------------------------------------------------------
+        /**
+         * Any rating by enum, for code that loops over all of them.
+         */
+        int get(Attribute attribute) const;
+        void set(Attribute attribute, int value);
 
-        // ------------------------------
-        // Hitting Attributes
-        // ------------------------------
-        int contact;         ///< Probability of making solid contact (199)
-        int power;           ///< Likelihood of hitting extra-base hits or HR
-        int plateDiscipline; ///< Affects walk rate / chase tendencies
+        /**
+         * Move this player's ratings into a new row of 'table' and become a view over it.
+         * Returns the new player ID. If already bound, the current ratings are copied over.
+         */
+        int bindToTable(AttributeTable& table);
 
-        // ------------------------------
-        // Pitching Attributes
-        // ------------------------------
-        int pitchVelocity;   ///< Speed of pitches
-        int pitchControl;    ///< Accuracy for hitting spots
-        int pitchMovement;   ///< Movement/break on pitches
-        int stamina;         ///< Optional: how long they can pitch effectively
+        /**
+         * Copy the row's ratings back into this object and stop viewing the table.
+         */
+        void unbind();
 
-        // ------------------------------
-        // Fielding Attributes
-        // ------------------------------
-        int reactionTime;    ///< Quickness to respond to batted balls
-        int armAccuracy;     ///< Or 'armStrength'
-        int fieldingRange;   ///< How much ground the fielder can cover
+        bool isBound() const;
+        AttributeTable* getTable() const;
+        int getPlayerID() const;    ///< -1 while not bound
+
+    private:
+        // Helper to clamp a given value into [1..99].
+        int clampValue(int raw);
 
         // ------------------------------
-        // Speed / Baserunning
+        // Own ratings (used while not bound to a table), indexed by Attribute:
+        // hitting (contact, power, plateDiscipline), pitching (velocity, control, movement,
+        // stamina), fielding (reactionTime, armAccuracy, fieldingRange), speed,
+        // and the optional durability & clutch.
         // ------------------------------
-        int speed;           ///< Overall speed, can apply to baserunning & fielding
+        std::uint8_t values[AttributeCount];
 
         // ------------------------------
-        // Optional Additional Ratings
+        // Table binding (nullptr => use 'values')
         // ------------------------------
-        int durability;      ///< E.g., likelihood to remain healthy
-        int clutch;          ///< Bonus in key situations if your sim uses it
+        AttributeTable* table;
+        int playerID;
     };
 
 } // namespace BBEngine
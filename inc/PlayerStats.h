@@ -96,6 +96,12 @@ namespace BBEngine
         int    getLosses()          const;
         int    getSaves()           const;
 
+        /**
+         * Bumped by every add...() and resetStats(). Caches of these counters (StatsManager's
+         * table) compare it to see whether their copy is stale.
+         */
+        unsigned long long getVersion() const;
+
         // ------------------------------------------------------
         // Utility - If you want to reset for a new season
         // ------------------------------------------------------
@@ -127,6 +133,8 @@ namespace BBEngine
         int wins;
         int losses;
         int saves;
+
+        unsigned long long version;
     };
 
 } // namespace BBEngine
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "StatRegistry.h"
+#include "StatsTable.h"
+
+namespace BBEngine
+{
+    /**
+     * Which kind of record.
+     */
+    enum class RecordScope : std::uint8_t
+    {
+        SingleGame,     // counting stats only (a 2-for-2 day isn't a batting average record)
+        SingleSeason,
+        Career,
+        Count
+    };
+
+    constexpr std::size_t RecordScopeCount = static_cast<std::size_t>(RecordScope::Count);
+
+    /**
+     * One line of a record list. 'when' is the game ID for single-game records, the year
+     * for single-season records, and the year of the last update for career records.
+     */
+    struct RecordEntry
+    {
+        int playerID = -1;
+        int when = 0;
+        double value = 0.0;
+    };
+
+    /**
+     * Emitted when a record (the #1 spot of a list) changes hands or its value changes.
+     */
+    struct RecordEvent
+    {
+        StatId stat;
+        RecordScope scope;
+        RecordEntry record;     // the new record
+        RecordEntry previous;   // the old one; playerID -1 if the list was empty
+    };
+
+    /**
+     * The record book: for every scope and every registered stat, the best 'listSize' entries
+     * ever seen, best first ("best" = the stat's own direction, so ERA records are minimums).
+     *
+     * Everything is indexed by enum, so there's no string work. Updates come in bulk from a
+     * StatsTable (a day's games, a season, whole careers): the stat is computed for every row
+     * in one kernel pass, and a row only goes near the list if it beats the current last entry
+     * (or already has an entry there to revise).
+     *
+     * Nothing is printed. When a record falls, a RecordEvent goes to the listener (if any) and
+     * into a queue you can drain whenever convenient.
+     */
+    class RecordBook
+    {
+    public:
+        using Listener = std::function<void(const RecordEvent&)>;
+
+        explicit RecordBook(int listSize = 10);
+
+        int getListSize() const;
+
+        void setListener(const Listener& listener);
+
+        /**
+         * Events since the last drain, oldest first.
+         */
+        std::vector<RecordEvent> drainEvents();
+        std::size_t getPendingEventCount() const;
+
+        /**
+         * Offer every listed row of 'table' for every stat in 'scope'. 'when' goes into the
+         * entries (game ID / year); 'teamGames' sets the qualifying minimum for rate stats
+         * (0 => no minimum). A player keeps one entry per (scope, when), or one per career.
+         *
+         * Single-game entries are final: only a better value replaces one. Season and career
+         * entries hold the current value, so a season-to-date or career rate that drops takes
+         * its entry down with it (off the list, if others now beat it, or if the player no
+         * longer qualifies).
+         */
+        void update(RecordScope scope, int when, const StatsTable& table,
+            const std::vector<int>& playerIDs, int teamGames);
+
+        /**
+         * The top-N list for one scope and stat, best first.
+         */
+        const std::vector<RecordEntry>& getRecords(RecordScope scope, StatId stat) const;
+
+        /**
+         * The record itself; playerID -1 if nothing has been recorded yet.
+         */
+        RecordEntry getRecord(RecordScope scope, StatId stat) const;
+
+        void clear();
+
+    private:
+        // Offer one value to one list, replacing the player's entry for the same key
+        void offer(RecordScope scope, StatId stat, const RecordEntry& entry);
+
+        // Drop a player's entry for the same key (season/career entries that stopped qualifying)
+        void withdraw(RecordScope scope, StatId stat, int playerID, int when);
+
+        // Emit an event if the #1 spot is no longer 'previous'
+        void announce(RecordScope scope, StatId stat, const RecordEntry& previous);
+
+        static bool better(StatId stat, double a, double b);
+
+        int listSize;
+        std::array<std::array<std::vector<RecordEntry>, StatIdCount>, RecordScopeCount> lists;
+
+        Listener listener;
+        std::vector<RecordEvent> events;
+
+        // Reused kernel output & qualification mask
+        std::vector<double> values;
+        std::vector<std::uint8_t> qualified;
+
+        // Rows that already have a season/career entry in the list being updated (all zeros
+        // between updates), and their IDs
+        std::vector<std::uint8_t> held;
+        std::vector<int> holders;
+    };
+
+} // namespace BBEngine
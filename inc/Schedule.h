@@ -2,6 +2,11 @@
 
 #include <vector>
 #include <string>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <unordered_map>
 #include "Team.h"
 #include "BoxScore.h" // If you want to reference a BoxScore pointer
 
@@ -31,13 +36,62 @@ namespace BBEngine
         }
     };
 
+    /**
+     * A non-owning view of some of a Schedule's games (e.g. one date), in gameID order.
+     * It just walks a list of indices into the schedule's game vector, so nothing is copied.
+     * Like any view, it's only valid until the schedule changes shape
+     * (generateSchedule or postponeGame); recording results is fine.
+     */
+    class GameRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = GameEntry;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const GameEntry*;
+            using reference = const GameEntry&;
+
+            iterator() : games(nullptr), index(nullptr) {}
+            iterator(const GameEntry* g, const int* i) : games(g), index(i) {}
+
+            reference operator*() const { return games[*index]; }
+            pointer operator->() const { return &games[*index]; }
+            iterator& operator++() { ++index; return *this; }
+            iterator operator++(int) { iterator old = *this; ++index; return old; }
+            bool operator==(const iterator& other) const { return index == other.index; }
+            bool operator!=(const iterator& other) const { return index != other.index; }
+
+        private:
+            const GameEntry* games;
+            const int* index;
+        };
+
+        GameRange() : games(nullptr), first(nullptr), last(nullptr) {}
+        GameRange(const GameEntry* g, const int* f, const int* l) : games(g), first(f), last(l) {}
+
+        iterator begin() const { return iterator(games, first); }
+        iterator end() const { return iterator(games, last); }
+        std::size_t size() const { return static_cast<std::size_t>(last - first); }
+        bool empty() const { return first == last; }
+        const GameEntry& operator[](std::size_t i) const { return games[first[i]]; }
+
+    private:
+        const GameEntry* games;
+        const int* first;
+        const int* last;
+    };
+
     class Schedule
     {
     public:
         /**
          * Default constructor: empty schedule.
+         * The games and the indexes over them allocate from 'resource' (League passes the season arena).
          */
-        Schedule();
+        explicit Schedule(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
         /**
          * Possibly a constructor that takes a set of teams or config,
@@ -54,12 +108,31 @@ namespace BBEngine
         /**
          * Return all games in this schedule, if needed.
          */
-        const std::vector<GameEntry>& getAllGames() const;
+        const std::pmr::vector<GameEntry>& getAllGames() const;
 
         /**
-         * Return all games scheduled on a given date.
+         * Return all games scheduled on a given date, in gameID order.
+         * This is a view into the schedule (see GameRange), not a copy.
          */
-        std::vector<GameEntry> getGamesOn(int date) const;
+        GameRange getGamesOn(int date) const;
+
+        /**
+         * Look up a game by ID in constant time. Returns nullptr if there's no such game.
+         */
+        const GameEntry* findGame(int gameID) const;
+
+        /**
+         * Completion bookkeeping. These are kept up to date as results come in and games get
+         * postponed, so none of them scan the schedule.
+         */
+        int getCompletedCount() const;
+        int getRemainingCount() const;
+        bool allGamesCompleted() const;
+
+        /**
+         * The first date >= fromDate that still has unplayed games, or -1 if there is none.
+         */
+        int getNextUnplayedDate(int fromDate) const;
 
         /**
          * Record final results for a game (set completed=true, store home/awayScore).
@@ -72,6 +145,12 @@ namespace BBEngine
          */
         void setGameCompleted(int gameID, BoxScore* box);
 
+        /**
+         * Detach a game's BoxScore (e.g. because the object is about to be reused).
+         * The game stays completed and keeps its final score.
+         */
+        void clearBoxScore(int gameID);
+
         /**
          * Mark or move a game to a new date if postponed.
          */
@@ -84,8 +163,33 @@ namespace BBEngine
          */
         int findGameIndexByID(int gameID) const;
 
+        /**
+         * Append a game and index it by ID and by date.
+         */
+        void addGame(const GameEntry& game);
+
+        /**
+         * Flip a game to completed and update the counters (no-op if it already was).
+         */
+        void markCompleted(int idx);
+
         // The container of all scheduled games for this season
-        std::vector<GameEntry> games;
+        std::pmr::vector<GameEntry> games;
+
+        // gameID -> index in 'games'. IDs are handed out sequentially from firstGameID,
+        // so this is a dense vector rather than a hash map; -1 marks a hole.
+        std::pmr::vector<int> indexByID;
+
+        // date -> indices in 'games' for that date, kept sorted (which is also gameID order)
+        std::pmr::unordered_map<int, std::pmr::vector<int>> gamesByDate;
+
+        // How many games are done, and how many unplayed games each date still has.
+        // Ordered by date so "next date with work to do" is a lower_bound.
+        int completedCount;
+        std::pmr::map<int, int> remainingByDate;
+
+        // ID of the first game this schedule hands out
+        int firstGameID;
 
         // Next ID to assign to a new game
         int nextGameID;
@@ -2,9 +2,16 @@
 #pragma once
 
 #include <vector>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <cstdint>
 #include "Team.h"
 #include "Schedule.h"
 #include "Standings.h"
+#include "Simulator.h"
+#include "BoxScore.h"
+#include "ThreadPool.h"
 
 namespace BBEngine
 {
@@ -13,10 +20,13 @@ namespace BBEngine
     public:
         /**
          * Constructor: pass references to the teams, schedule, and standings for this season.
+         * The season's own containers and its pooled BoxScores allocate from 'resource'
+         * (League passes the season arena).
          */
         Season(const std::vector<Team*>& participatingTeams,
             Schedule* sched,
-            Standings* stand);
+            Standings* stand,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
         /**
          * Optional: mark that the season has started (set any flags).
@@ -26,11 +36,33 @@ namespace BBEngine
 
         /**
          * For a day-based sim: simulate the games on a particular date.
-         * Usually you'd create a GameManager for each game and run it,
-         * then record the final scores in schedule & standings.
+         *
+         * Every unplayed game gets a GameManager and a BoxScore and is played pitch by pitch.
+         * The day's games are independent, so each one runs as its own task on a thread pool,
+         * with one Simulator per worker thread. Once every game has finished, the results are
+         * merged in gameID order (Schedule::setGameCompleted, then the standings), so the
+         * outcome is the same for any number of threads.
+         *
+         * BoxScores come from a pool that is reused from day to day. A game's BoxScore stays
+         * attached to its GameEntry until the next simulateDay() call recycles it, so read
+         * (or copy) anything you need from it before simulating the next day.
          */
         void simulateDay(int date);
 
+        /**
+         * Seed for every game of the season. Game g always uses stream g of this seed,
+         * so a given seed reproduces the whole season exactly. Defaults to a random seed.
+         */
+        void setSeed(std::uint64_t newSeed);
+        std::uint64_t getSeed() const;
+
+        /**
+         * How many threads simulateDay() may use. 0 (the default) => one per hardware thread,
+         * 1 => run everything on the calling thread.
+         */
+        void setWorkerThreads(int threads);
+        int getWorkerThreads() const;
+
         /**
          * If you want to manually record a game result (bypassing a GameManager).
          */
@@ -41,6 +73,12 @@ namespace BBEngine
          */
         bool isSeasonOver() const;
 
+        /**
+         * The first date >= fromDate that still has unplayed games, or -1 once everything is played.
+         * Handy for driving a season day by day without knowing the calendar up front.
+         */
+        int getNextGameDate(int fromDate) const;
+
         /**
          * Called when the season is fully done: finalize standings, handle playoffs, etc.
          */
@@ -55,13 +93,49 @@ namespace BBEngine
 
     private:
         // Data members
-        std::vector<Team*> teams;
+        std::pmr::vector<Team*> teams;
         Schedule* schedule;
         Standings* standings;
 
         bool seasonStarted;
         bool seasonComplete;
 
+        // Parallel day execution
+        std::uint64_t seed;
+        int workerThreads;
+        std::unique_ptr<ThreadPool> pool;
+        std::pmr::vector<Simulator> simulators; // one per pool worker
+
+        // Pooled BoxScores, reused across days, and the games they're currently attached to.
+        // A deque, so growing the pool never moves a box a GameEntry points to.
+        std::pmr::deque<BoxScore> boxPool;
+        std::pmr::vector<int> boxPoolGameIDs;
+
+        // Scratch list of the day's games, kept around so it doesn't reallocate every day
+        std::pmr::vector<const GameEntry*> dayGames;
+
+        /**
+         * Private helper: (re)build the pool and per-worker simulators if the thread count changed.
+         */
+        void ensureWorkers();
+
+        /**
+         * Private helper: hand out 'count' pooled BoxScores for today, detaching them
+         * from whatever games they were attached to yesterday.
+         */
+        void acquireBoxScores(std::size_t count);
+
+        /**
+         * Private helper: play one game into 'box'. Runs on a pool thread, so it must not touch
+         * the schedule or standings; it only reads the GameEntry and uses its worker's Simulator.
+         */
+        void playGame(const GameEntry& game, BoxScore& box, Simulator& sim) const;
+
+        /**
+         * Private helper: credit the win and loss for a finished game.
+         */
+        void updateStandingsForGame(int gameID, int awayScore, int homeScore);
+
         /**
          * Private helper: check if all schedule games are completed => can end season
          */
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace BBEngine
+{
+    /**
+     * A bump allocator for everything that belongs to one season (Schedule, Standings, Season, ...).
+     *
+     * Objects are carved out of big blocks one after another, and nothing is freed individually.
+     * When the season is done, release() runs every destructor (newest first) and hands all the
+     * memory back in one go. The first block is owned by the arena and survives release(), so a
+     * league that plays season after season keeps reusing the same memory instead of growing.
+     *
+     * Containers live here too when they're given getResource() as their std::pmr::memory_resource:
+     * League hands it to the season's Schedule, Standings and Season, so the game entries, the
+     * date/ID indexes, the pooled BoxScores and their lines all come out of the arena. Freeing
+     * through the resource is a no-op; the memory comes back at release().
+     *
+     * Allocation takes a lock, because a pooled BoxScore can grow its line score from a worker
+     * thread in extra innings. create() and release() are still meant for one thread (League
+     * calls them between seasons).
+     */
+    class SeasonArena
+    {
+    public:
+        explicit SeasonArena(std::size_t initialBlockSize = 64 * 1024);
+        ~SeasonArena();
+
+        SeasonArena(const SeasonArena&) = delete;
+        SeasonArena& operator=(const SeasonArena&) = delete;
+
+        /**
+         * Construct a T in the arena. It lives until release() (or the arena's destruction);
+         * never delete it yourself.
+         */
+        template<typename T, typename... Args>
+        T* create(Args&&... args)
+        {
+            void* memory = allocate(sizeof(T), alignof(T));
+            T* object = ::new (memory) T(std::forward<Args>(args)...);
+            if (!std::is_trivially_destructible<T>::value)
+            {
+                registerDestructor(object, [](void* p) { static_cast<T*>(p)->~T(); });
+            }
+            return object;
+        }
+
+        /**
+         * Raw storage, e.g. for arrays of trivially destructible data.
+         */
+        void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * Destroy everything created since the last release(), newest first, and free every block
+         * except the arena's own first one.
+         */
+        void release();
+
+        /**
+         * For std::pmr containers that should allocate from this arena. What they take is counted
+         * in getBytesAllocated().
+         */
+        std::pmr::memory_resource* getResource();
+
+        // Diagnostics
+        std::size_t getBytesAllocated() const;  ///< handed out since the last release()
+        std::size_t getObjectCount() const;     ///< objects with a pending destructor
+        std::size_t getInitialBlockSize() const;
+
+    private:
+        // getResource(): forwards to allocate(), ignores deallocation
+        class Resource : public std::pmr::memory_resource
+        {
+        public:
+            explicit Resource(SeasonArena* owner) : arena(owner) {}
+
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+            SeasonArena* arena;
+        };
+
+        struct DestructorEntry
+        {
+            void (*destroy)(void*);
+            void* object;
+            DestructorEntry* next;
+        };
+
+        void registerDestructor(void* object, void (*destroy)(void*));
+
+        std::size_t initialSize;
+        std::unique_ptr<std::byte[]> initialBlock;
+        std::pmr::monotonic_buffer_resource resource;
+        Resource containerResource;
+        std::mutex mutex;           // guards 'resource' and bytesAllocated
+
+        DestructorEntry* destructors;   // newest first
+        std::size_t bytesAllocated;
+        std::size_t objectCount;
+    };
+
+} // namespace BBEngine
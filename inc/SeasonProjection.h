@@ -0,0 +1,148 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include "Team.h"
+#include "Schedule.h"
+#include "Standings.h"
+
+namespace BBEngine
+{
+    class Season;
+
+    /**
+     * What the projection thinks of one team, averaged over every replica.
+     */
+    struct TeamProjection
+    {
+        Team* team;
+        std::string division;
+
+        double meanWins;
+        double meanLosses;
+
+        double playoffProbability;   // got one of the playoff spots
+        double divisionProbability;  // won its division
+
+        std::vector<double> seedProbability;   // [k] = P(seed k+1), one entry per playoff spot
+        std::vector<double> finishProbability; // [k] = P(finished k+1 overall)
+        std::vector<double> winDistribution;   // [w] = P(finished with exactly w wins)
+
+        TeamProjection()
+            : team(nullptr), meanWins(0.0), meanLosses(0.0),
+            playoffProbability(0.0), divisionProbability(0.0)
+        {
+        }
+    };
+
+    /**
+     * "Rest of season" Monte Carlo: take the current standings and the games still left on the
+     * schedule, play the remainder out N times and report how often each team finished where.
+     *
+     * Construction forks the live season: it snapshots the records and the unplayed games into
+     * an immutable state that every replica (and every copy of this object) shares. A replica
+     * never copies the standings; it only keeps its own win/loss deltas on top of the shared
+     * snapshot, in per-thread scratch that is reused from one replica to the next.
+     *
+     * Replicas are spread over a ThreadPool. Each worker tallies into its own counters, which
+     * are added up at the end, so memory doesn't grow with N. Replica r always draws from
+     * stream r of the seed, so results are identical for any thread count. Replicas use their
+     * own CounterRng domain, so replica r doesn't reuse the numbers of game r of the season.
+     *
+     * The real Season/Schedule/Standings are never touched.
+     */
+    class SeasonProjection
+    {
+    public:
+        /**
+         * P(home team wins) for a single game. It's evaluated once per remaining game when
+         * run() starts, not once per replica, so it should depend only on the two teams.
+         */
+        using GameModel = std::function<double(const Team* home, const Team* away)>;
+
+        SeasonProjection(const Schedule& schedule, const Standings& standings);
+
+        /**
+         * Fork a live season: uses its schedule, standings and seed.
+         */
+        explicit SeasonProjection(const Season& season);
+
+        /**
+         * Replace the default game model (log5 on the current records, see defaultGameModel()).
+         */
+        void setGameModel(const GameModel& model);
+
+        void setSeed(std::uint64_t newSeed);
+        std::uint64_t getSeed() const;
+
+        /**
+         * 0 (the default) => one thread per hardware thread, 1 => run on the calling thread.
+         */
+        void setWorkerThreads(int threads);
+        int getWorkerThreads() const;
+
+        /**
+         * How many teams make the playoffs. Division winners are seeded first (by record),
+         * then the best of the rest. Defaults to 6.
+         */
+        void setPlayoffSpots(int spots);
+        int getPlayoffSpots() const;
+
+        /**
+         * Games still to be played in the snapshot.
+         */
+        int getRemainingGameCount() const;
+
+        /**
+         * Play out the remainder 'replicas' times. The result has one entry per team,
+         * in the order of the standings at the time of the fork.
+         */
+        std::vector<TeamProjection> run(int replicas) const;
+
+        /**
+         * The default model: log5 on each team's current winning percentage (padded with
+         * 10 wins and 10 losses so early-season records don't run wild), plus a small home edge.
+         */
+        GameModel defaultGameModel() const;
+
+    private:
+        struct ProjectedGame
+        {
+            int home; // team index
+            int away;
+        };
+
+        // Everything the replicas read. Built once at fork time and never modified.
+        struct SeasonState
+        {
+            std::vector<Team*> teams;
+            std::vector<std::string> divisions;  // per team
+            std::vector<int> divisionOf;         // per team, dense division index
+            int divisionCount = 0;
+            std::vector<int> wins;               // per team, at fork time
+            std::vector<int> losses;
+            std::vector<ProjectedGame> games;    // the unplayed games
+            int maxWins = 0;                     // most wins any team can still reach
+        };
+
+        // One worker's counters plus its per-replica scratch
+        struct Tally;
+
+        // CounterRng domain of the replicas ("PROJ"); games are domain 0
+        static constexpr std::uint32_t RngDomain = 0x50524F4Au;
+
+        void fork(const Schedule& schedule, const Standings& standings);
+
+        void runReplica(std::uint32_t replica, const std::vector<double>& homeWinProb, Tally& tally) const;
+
+        std::shared_ptr<const SeasonState> state;
+        GameModel model;
+        std::uint64_t seed;
+        int workerThreads;
+        int playoffSpots;
+    };
+
+} // namespace BBEngine
@@ -1,7 +1,10 @@
 #pragma once
 
-#include <random>
+#include <cstddef>
+#include <cstdint>
 #include "PlayerAttributes.h" // So we can read pitcher & batter ratings
+#include "MatchupTable.h"
+#include "CounterRng.h"
 
 namespace BBEngine
 {
@@ -45,17 +48,102 @@ namespace BBEngine
         // etc. if you want
     };
 
+    /**
+     * One pitcher/batter pairing for the batched pitch kernel.
+     * The pointers are borrowed; they only need to stay valid for the duration of the call.
+     */
+    struct PitchMatchup
+    {
+        const PlayerAttributes* pitcher = nullptr;
+        const PlayerAttributes* batter = nullptr;
+    };
+
+    /**
+     * Just the ratings the pitch model reads, copied out of PlayerAttributes (which clamps them to 1..99).
+     * GameManager resolves these once per game, or per pitching change, so the per-pitch loop reads
+     * a few bytes of its own state instead of chasing Team -> Player -> PlayerAttributes pointers.
+     */
+    struct PitcherRatings
+    {
+        std::uint8_t control = 50;
+        std::uint8_t velocity = 50;
+
+        static PitcherRatings from(const PlayerAttributes& attr)
+        {
+            PitcherRatings r;
+            r.control = static_cast<std::uint8_t>(attr.getPitchControl());
+            r.velocity = static_cast<std::uint8_t>(attr.getPitchVelocity());
+            return r;
+        }
+    };
+
+    struct BatterRatings
+    {
+        std::uint8_t contact = 50;
+        std::uint8_t power = 50;
+        std::uint8_t discipline = 50;
+
+        static BatterRatings from(const PlayerAttributes& attr)
+        {
+            BatterRatings r;
+            r.contact = static_cast<std::uint8_t>(attr.getContact());
+            r.power = static_cast<std::uint8_t>(attr.getPower());
+            r.discipline = static_cast<std::uint8_t>(attr.getPlateDiscipline());
+            return r;
+        }
+    };
+
     /**
      * The Simulator class handles pitch-by-pitch logic. It's mostly stateless:
      * you pass in the relevant data each time you call simulatePitch(...).
+     *
+     * Randomness comes from a CounterRng keyed by (seed, stream, pitch index). Each call to
+     * simulatePitch() starts a fresh pitch index, so a game seeded with beginGame() produces the same
+     * pitches no matter which thread or which Simulator instance runs it.
      */
     class Simulator
     {
     public:
+        /**
+         * Default constructor seeds from std::random_device (non-reproducible runs).
+         */
         Simulator();
 
-        // If you want the simulator to hold its own RNG engine
-        void setRandomEngine(std::mt19937 newEngine);
+        /**
+         * Reproducible constructor: all randomness is derived from 'seed'.
+         */
+        explicit Simulator(std::uint64_t seed);
+
+        // ----------------------------------------------------
+        // Random engine control
+        // ----------------------------------------------------
+        /**
+         * Replace the whole engine state (seed, stream and position). Cheap: it's 44 bytes.
+         */
+        void setRandomEngine(const CounterRng& newEngine);
+        CounterRng& getRandomEngine();
+        const CounterRng& getRandomEngine() const;
+
+        void setSeed(std::uint64_t seed);
+        std::uint64_t getSeed() const;
+
+        /**
+         * Start a new game: selects the gameID stream and rewinds the pitch index to 0.
+         */
+        void beginGame(int gameID);
+
+        /**
+         * The index the next simulatePitch() call will use. Exposed so a game can be
+         * resumed or replayed from any pitch.
+         */
+        std::uint32_t getPitchIndex() const;
+        void setPitchIndex(std::uint32_t index);
+
+        /**
+         * Swap in a probability table built for a custom formula (see MatchupTable.h).
+         * The table must outlive the Simulator. By default we use defaultMatchupTable().
+         */
+        void setMatchupTable(const MatchupTableView& table);
 
         /**
          * The main method that decides whether the pitch is a ball, strike, foul, or in-play
@@ -69,6 +157,31 @@ namespace BBEngine
             const StadiumContext& stadium,
             const PitchContext& pitchCtx);
 
+        /**
+         * Same as above, on pre-resolved ratings. Both overloads draw the same random numbers,
+         * so they return identical outcomes.
+         */
+        PitchOutcome simulatePitch(const PitcherRatings& pitcher,
+            const BatterRatings& batter,
+            const StadiumContext& stadium,
+            const PitchContext& pitchCtx);
+
+        /**
+         * Batched version of simulatePitch() for Monte Carlo style workloads.
+         * Simulates 'count' independent pitches: matchups[i] with contexts[i] writes outcomes[i].
+         *
+         * Pitch i uses pitch index getPitchIndex() + i, exactly as 'count' calls to simulatePitch()
+         * would, so the two paths return identical outcomes and leave the engine in the same state.
+         * simulatePitch() remains the reference implementation; this one splits the work into a
+         * probability pass, a counter-based random pass and a branch-free resolve pass, none of which
+         * carry a dependency from one pitch to the next, so the compiler can vectorize them.
+         */
+        void simulatePitches(const PitchMatchup* matchups,
+            const PitchContext* contexts,
+            std::size_t count,
+            const StadiumContext& stadium,
+            PitchOutcome* outcomes);
+
         /**
          * If we have an in-play ball, let's see if it's a single/double/triple/homerun or out,
          * using random logic + partial references to stadium distances.
@@ -79,23 +192,31 @@ namespace BBEngine
             const PlayerAttributes& batterAttr,
             const StadiumContext& stadium);
 
+        BattedBallOutcome computeBattedBallOutcome(const PitcherRatings& pitcher,
+            const BatterRatings& batter,
+            const StadiumContext& stadium);
+
     private:
         /**
-         * e.g., returns 0..1 probability. We'll do a simplistic approach combining pitcher & batter ratings.
+         * Returns a 0..1 probability, looked up from the matchup table rather than computed per pitch.
          */
-        double getStrikeProbability(const PlayerAttributes& pitcherAttr,
-            const PlayerAttributes& batterAttr,
-            const PitchContext& pitchCtx);
+        double getStrikeProbability(const PitcherRatings& pitcher,
+            const BatterRatings& batter,
+            const PitchContext& pitchCtx) const;
 
-        double getContactProbability(const PlayerAttributes& pitcherAttr,
-            const PlayerAttributes& batterAttr);
+        double getContactProbability(const PitcherRatings& pitcher,
+            const BatterRatings& batter) const;
 
         // If we do in-play distance logic, we can do a simple function
-        double estimateHitDistance(const PlayerAttributes& pitcherAttr,
-            const PlayerAttributes& batterAttr);
+        double estimateHitDistance(const PitcherRatings& pitcher,
+            const BatterRatings& batter);
+
+        // Our random engine, and the pitch index the next simulatePitch() will use
+        CounterRng rng;
+        std::uint32_t nextPitchIndex;
 
-        // Our random engine
-        std::mt19937 rng;
+        // Precomputed strike/contact probabilities
+        MatchupTableView matchupTable;
     };
 
 } // namespace BBEngine
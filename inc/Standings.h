@@ -2,6 +2,9 @@
 
 #include <vector>
 #include <string>
+#include <cstddef>
+#include <memory_resource>
+#include <set>
 #include <unordered_map>
 #include "Team.h"
 
@@ -28,13 +31,18 @@ namespace BBEngine
         /**
          * Constructor: pass in a list of Team*.
          * Optionally store or detect divisions. For simplicity, we ignore divisions or pass them as the same.
+         * The records, the ranking and the snapshot allocate from 'resource' (League passes the season arena).
          */
-        Standings(const std::vector<Team*>& allTeams, const std::string& defaultDivision = "");
+        Standings(const std::vector<Team*>& allTeams, const std::string& defaultDivision = "",
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
         // --- Updating Records ---
         /**
          * recordWin / recordLoss for a given Team.
          * If the team is not found, do nothing or throw.
+         * The ranking is kept up to date as results come in: the teams sit in an ordered set,
+         * so a result moves one team with an O(log n) extract + insert (the node is reused,
+         * nothing is allocated) instead of re-sorting everybody.
          */
         void recordWin(Team* team);
         void recordLoss(Team* team);
@@ -46,8 +54,8 @@ namespace BBEngine
 
         // --- Sorting & Ranking ---
         /**
-         * updateStandings: sorts each division or the entire set by best record
-         * also calls computeGamesBehind() to fill the gamesBehind field.
+         * updateStandings: the order is always current now, so this just makes sure the
+         * snapshot (with games-behind) is rebuilt. Calling it per game is harmless but unnecessary.
          */
         void updateStandings();
 
@@ -56,6 +64,19 @@ namespace BBEngine
          */
         std::vector<TeamRecord> getOverallStandings() const;
 
+        /**
+         * The sorted standings with gamesBehind filled in, without copying.
+         * It is rebuilt lazily, only when a result has come in since the last call, so readers
+         * polling it between games pay nothing. Not safe to call while another thread records results.
+         */
+        const std::pmr::vector<TeamRecord>& getSnapshot() const;
+
+        /**
+         * Bumped on every recorded win/loss. Readers can hold on to a snapshot and
+         * compare versions to see whether it's stale.
+         */
+        unsigned long long getVersion() const;
+
         // If you track divisions, a method to get a sub-list:
         std::vector<TeamRecord> getStandingsForDivision(const std::string& division) const;
 
@@ -64,17 +85,54 @@ namespace BBEngine
         int getLosses(Team* team) const;
 
     private:
-        // The container for all records
-        std::vector<TeamRecord> records;
+        // The container for all records, in construction order. A record never moves,
+        // so its index is a stable dense ID for the team.
+        std::pmr::vector<TeamRecord> records;
 
-        // Helper to find a record for a team
-        TeamRecord* findRecord(Team* team);
+        // Team* -> index in 'records'
+        std::pmr::unordered_map<Team*, int> recordIndex;
 
-        // If you want to do advanced logic for each division, you might do it here
-        void computeGamesBehind();
+        // One team's place in the ranking. Sorted by (wins - losses) descending, then by team
+        // name (pre-ranked, so the tiebreak compares ints instead of strings), then by record
+        // index if two teams share a name.
+        struct RankKey
+        {
+            int diff;
+            int nameRank;
+            int rec;
+
+            bool operator<(const RankKey& other) const
+            {
+                if (diff != other.diff)
+                    return diff > other.diff;
+                if (nameRank != other.nameRank)
+                    return nameRank < other.nameRank;
+                return rec < other.rec;
+            }
+        };
 
-        // A custom sort function that sorts by W-L. We might do: sort by (wins descending, losses ascending).
-        static bool teamRecordCompare(const TeamRecord& a, const TeamRecord& b);
+        // Every record from first place to last
+        std::pmr::set<RankKey> ranking;
+
+        // Each record's rank by team name
+        std::pmr::vector<int> nameRank;
+
+        // Change counter and the lazily rebuilt snapshot
+        unsigned long long version;
+        mutable unsigned long long snapshotVersion;
+        mutable std::pmr::vector<TeamRecord> snapshot;
+
+        // Helper to find a record for a team (-1 if it isn't in these standings)
+        int findRecord(Team* team) const;
+
+        // The record's current key in 'ranking'
+        RankKey keyOf(int rec) const;
+
+        // Move one record to its correct place in 'ranking'; 'before' is its key before the W-L changed
+        void reposition(int rec, const RankKey& before);
+
+        // If you want to do advanced logic for each division, you might do it here
+        void computeGamesBehind(std::pmr::vector<TeamRecord>& sorted) const;
     };
 
 } // namespace BBEngine
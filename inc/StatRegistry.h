@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "PlayerStats.h"
+#include "StatsTable.h"
+
+namespace BBEngine
+{
+    /**
+     * Every stat StatsManager can rank, total or track records for.
+     *
+     * To add one: add the enum value here (before Count) and a matching row to StatRegistry
+     * below. Nothing else dispatches on the stat, so no if-chain needs touching.
+     */
+    enum class StatId : std::uint8_t
+    {
+        AVG,
+        OBP,
+        SLG,
+        OPS,
+        HR,
+        RBI,
+        ERA,
+        WHIP,
+        Count
+    };
+
+    constexpr std::size_t StatIdCount = static_cast<std::size_t>(StatId::Count);
+
+    /**
+     * Which way is "better" for a stat (and so the default leaderboard order).
+     */
+    enum class SortDirection : std::uint8_t
+    {
+        HigherIsBetter,
+        LowerIsBetter
+    };
+
+    /**
+     * What a player needs to qualify for a rate-stat leaderboard.
+     */
+    enum class Qualifier : std::uint8_t
+    {
+        None,               // counting stats: everybody qualifies
+        PlateAppearances,   // batting rates
+        InningsPitched      // pitching rates
+    };
+
+    /**
+     * How getTeamStat() combines a roster.
+     */
+    enum class AggregateMethod : std::uint8_t
+    {
+        Sum,
+        Average
+    };
+
+    /**
+     * Everything the engine knows about one stat. All of it is constexpr: the name,
+     * the default direction, the qualifying minimum and the formula in both forms
+     * (one player from a PlayerStats, every player from a StatsTable).
+     */
+    struct StatInfo
+    {
+        StatId id;
+        const char* name;
+        SortDirection direction;
+        Qualifier qualifier;
+        double qualifyingPerTeamGame;   // e.g. 3.1 PA per team game, MLB-style
+        double (*value)(const PlayerStats& stats);
+        void (*column)(const StatsTable& table, std::vector<double>& out);
+    };
+
+    namespace StatFormulas
+    {
+        constexpr double NoInningsRate = StatsTable::NoInningsRate;
+
+        inline double slugging(const PlayerStats& ps)
+        {
+            int ab = ps.getAtBats();
+            if (ab == 0) return 0.0;
+            int singles = ps.getHits() - (ps.getDoubles() + ps.getTriples() + ps.getHomeRuns());
+            int totalBases = singles + 2 * ps.getDoubles() + 3 * ps.getTriples() + 4 * ps.getHomeRuns();
+            return static_cast<double>(totalBases) / ab;
+        }
+
+        inline double era(const PlayerStats& ps)
+        {
+            double ip = ps.getInningsPitched();
+            return (ip <= 0.0) ? NoInningsRate : (ps.getEarnedRuns() * 9.0) / ip;
+        }
+
+        inline double whip(const PlayerStats& ps)
+        {
+            double ip = ps.getInningsPitched();
+            return (ip <= 0.0) ? NoInningsRate : (ps.getWalksAllowed() + ps.getHitsAllowed()) / ip;
+        }
+    }
+
+    /**
+     * The registry itself, indexed by StatId.
+     */
+    inline constexpr StatInfo StatRegistry[] =
+    {
+        { StatId::AVG, "AVG", SortDirection::HigherIsBetter, Qualifier::PlateAppearances, 3.1,
+            [](const PlayerStats& ps) { return ps.getBattingAverage(); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeBattingAverage(out); } },
+        { StatId::OBP, "OBP", SortDirection::HigherIsBetter, Qualifier::PlateAppearances, 3.1,
+            [](const PlayerStats& ps) { return ps.getOnBasePercentage(); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeOnBasePercentage(out); } },
+        { StatId::SLG, "SLG", SortDirection::HigherIsBetter, Qualifier::PlateAppearances, 3.1,
+            [](const PlayerStats& ps) { return StatFormulas::slugging(ps); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeSlugging(out); } },
+        { StatId::OPS, "OPS", SortDirection::HigherIsBetter, Qualifier::PlateAppearances, 3.1,
+            [](const PlayerStats& ps) { return ps.getOnBasePercentage() + StatFormulas::slugging(ps); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeOPS(out); } },
+        { StatId::HR, "HR", SortDirection::HigherIsBetter, Qualifier::None, 0.0,
+            [](const PlayerStats& ps) { return static_cast<double>(ps.getHomeRuns()); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeCounter(StatColumn::HomeRuns, out); } },
+        { StatId::RBI, "RBI", SortDirection::HigherIsBetter, Qualifier::None, 0.0,
+            [](const PlayerStats& ps) { return static_cast<double>(ps.getRBIs()); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeCounter(StatColumn::RBIs, out); } },
+        { StatId::ERA, "ERA", SortDirection::LowerIsBetter, Qualifier::InningsPitched, 1.0,
+            [](const PlayerStats& ps) { return StatFormulas::era(ps); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeERA(out); } },
+        { StatId::WHIP, "WHIP", SortDirection::LowerIsBetter, Qualifier::InningsPitched, 1.0,
+            [](const PlayerStats& ps) { return StatFormulas::whip(ps); },
+            [](const StatsTable& t, std::vector<double>& out) { t.computeWHIP(out); } },
+    };
+
+    static_assert(sizeof(StatRegistry) / sizeof(StatRegistry[0]) == StatIdCount,
+        "StatRegistry needs exactly one row per StatId");
+
+    namespace StatRegistryDetail
+    {
+        constexpr bool rowsInOrder()
+        {
+            for (std::size_t i = 0; i < StatIdCount; ++i)
+            {
+                if (static_cast<std::size_t>(StatRegistry[i].id) != i)
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    static_assert(StatRegistryDetail::rowsInOrder(), "StatRegistry rows must be in StatId order");
+
+    constexpr const StatInfo& getStatInfo(StatId id)
+    {
+        return StatRegistry[static_cast<std::size_t>(id)];
+    }
+
+    /**
+     * The qualifying minimum (PA or IP) after 'teamGames' team games, MLB-style:
+     * qualifyingPerTeamGame * teamGames, with the fraction dropped (3.1 * 162 => 502 PA).
+     * 0 for counting stats.
+     */
+    double qualifyingMinimum(StatId stat, int teamGames);
+
+    /**
+     * String => StatId, for the API boundary ("AVG", "ERA", ...). Throws std::runtime_error
+     * for a name that isn't registered.
+     */
+    StatId parseStat(const std::string& name);
+
+    /**
+     * "SUM" or "AVG" => AggregateMethod. Anything else falls back to Sum, as getTeamStat() always did.
+     */
+    AggregateMethod parseAggregateMethod(const std::string& name);
+
+} // namespace BBEngine
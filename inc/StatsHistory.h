@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "StatsTable.h"
+#include "StatRegistry.h"
+
+namespace BBEngine
+{
+    /**
+     * Append-only, multi-season stat history: one compact snapshot of every player's counters
+     * per season, so careers survive PlayerStats::resetStats().
+     *
+     * Each season is stored column by column. The player IDs in it are delta-encoded, and every
+     * counter column is a stream of zigzag varints (1 byte for anything under 64, which is most
+     * of them), so a season of a few thousand players takes tens of KB instead of a PlayerStats
+     * object per player. Innings pitched are kept to the hundredth.
+     *
+     * Queries decode straight into a StatsTable (one row per player ID) and reuse the stat
+     * registry's column kernels: career totals, season splits and "best season ever" never
+     * build a PlayerStats.
+     */
+    class StatsHistory
+    {
+    public:
+        /**
+         * One player's season, as found by the best-season queries.
+         */
+        struct SeasonRecord
+        {
+            int playerID;
+            int year;
+            double value;
+        };
+
+        StatsHistory() = default;
+
+        /**
+         * Snapshot the given rows (ascending player IDs) of 'table' as a finished season.
+         * 'teamGames' is the season's length, used for qualification in the best-season queries.
+         * Returns the season's index (0 = the first season archived).
+         */
+        int appendSeason(int year, int teamGames, const StatsTable& table, const std::vector<int>& playerIDs);
+
+        int getSeasonCount() const;
+        int getSeasonYear(int seasonIndex) const;
+        int getSeasonTeamGames(int seasonIndex) const;
+        int getSeasonPlayerCount(int seasonIndex) const;
+
+        /**
+         * Highest player ID ever archived + 1, i.e. the row count loadSeason/loadCareer produce.
+         */
+        int getPlayerIDBound() const;
+
+        /**
+         * Total encoded size, for diagnostics.
+         */
+        std::size_t getEncodedBytes() const;
+
+        // ----------------------------------------------------------------
+        // Splits & careers
+        // ----------------------------------------------------------------
+        /**
+         * One season into 'out' (one row per player ID; players who didn't play are zero).
+         */
+        void loadSeason(int seasonIndex, StatsTable& out) const;
+
+        /**
+         * Every season added up into 'out'.
+         */
+        void loadCareer(StatsTable& out) const;
+
+        /**
+         * A single counter summed over a player's career; decodes only that column.
+         */
+        long long getCareerTotal(StatColumn column, int playerID) const;
+
+        // ----------------------------------------------------------------
+        // Best seasons
+        // ----------------------------------------------------------------
+        /**
+         * The best 'topN' single seasons for a stat across the whole history, best first.
+         * Rate stats only count qualified seasons (see qualifyingMinimum) when 'qualifiedOnly'.
+         */
+        std::vector<SeasonRecord> getBestSeasons(StatId stat, int topN, bool qualifiedOnly = true) const;
+
+        /**
+         * A player's best season for a stat; playerID -1 in the result if they have none.
+         * Only that player's values are decoded, one season at a time.
+         */
+        SeasonRecord getPlayerBestSeason(StatId stat, int playerID, bool qualifiedOnly = true) const;
+
+    private:
+        struct EncodedSeason
+        {
+            int year = 0;
+            int teamGames = 0;
+            int playerCount = 0;
+            std::vector<std::uint8_t> ids;                      // gaps between consecutive IDs
+            std::vector<std::uint8_t> columns[StatColumnCount]; // zigzag varints, one per player
+            std::vector<std::uint8_t> innings;                  // hundredths of an inning
+        };
+
+        const EncodedSeason& getSeason(int seasonIndex) const;
+        static std::vector<int> decodeIDs(const EncodedSeason& season);
+
+        // Where a player's values sit in the season's column streams, or -1 if they didn't play
+        static int findPosition(const EncodedSeason& season, int playerID);
+
+        // Visit (playerID, value) for every player of a season that passes 'qualifiedOnly'
+        template<typename Visit>
+        void forEachSeasonValue(int seasonIndex, StatId stat, bool qualifiedOnly, Visit visit) const;
+
+        std::vector<EncodedSeason> seasons;
+        int playerIDBound = 0;
+    };
+
+} // namespace BBEngine
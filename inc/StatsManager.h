@@ -4,8 +4,16 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <memory>
+#include <array>
 #include "Player.h"
 #include "Team.h"
+#include "StatsTable.h"
+#include "StatRegistry.h"
+#include "Leaderboard.h"
+#include "StatsHistory.h"
+#include "RecordBook.h"
+#include "BoxScore.h"
 
 namespace BBEngine
 {
@@ -13,6 +21,18 @@ namespace BBEngine
      * The StatsManager class aggregates stats from many players (and possibly teams),
      * generates leaderboards for hitting/pitching, can track all-time records,
      * and provides optional multi-season or advanced metrics.
+     *
+     * Every registered player gets a dense ID (0, 1, 2, ... in registration order) and a row in
+     * a columnar StatsTable. IDs never change; unregistering leaves a tombstone instead of
+     * shifting everyone after it.
+     *
+     * PlayerStats is the source of truth; the table is a cache of it. Each row remembers the
+     * PlayerStats version it was loaded from, and every query that reads the table (getLeaders(),
+     * getQualifiedLeaders(), getTeamStat(), archiveSeason(), updateSeasonRecords()) first reloads
+     * just the rows that changed since (a version compare per player), then computes the stat for
+     * everyone in one kernel pass. So the answers always match getStatValue(), whether or not
+     * anybody called notifyStatsChanged(). The subscribed leaderboards are the exception: they
+     * only move on notifyStatsChanged() and refreshStats().
      */
     class StatsManager
     {
@@ -35,35 +55,141 @@ namespace BBEngine
         void registerPlayer(Player* player);
         void unregisterPlayer(Player* player);
 
+        /**
+         * Dense ID of a registered player, or -1. getPlayer() returns nullptr for a tombstone.
+         */
+        int getPlayerID(Player* player) const;
+        Player* getPlayer(int playerID) const;
+        int getRegisteredCount() const;
+
+        /**
+         * Bring the table up to date (only changed rows are reloaded) and re-rank the subscribed
+         * boards, and read-only access to the table for kernels of your own. The table is as of
+         * the last query, notifyStatsChanged() or refreshStats(); call refreshStats() first if
+         * PlayerStats changed since.
+         */
+        void refreshStats();
+        const StatsTable& getStatsTable() const;
+
         /**
          * Return a sorted list of (Player*, value) for a given stat, with the topN or bottomN depending on
          * ascendingOrDescending (true => ascending, false => descending).
          * E.g., for "ERA" you might want ascending = true so best ERA is 1st.
+         *
+         * Only the topN are ever sorted: the rest of the league streams past a bounded heap,
+         * so the cost is O(n log topN). Ties go to the lower player ID.
          */
         std::vector<std::pair<Player*, double>>
             getLeaders(const std::string& stat,
                 int topN = 10,
                 bool ascending = false);
 
+        /**
+         * Enum-keyed versions: no string work at all. Without 'ascending', the stat's own
+         * direction from the registry is used (lowest ERA first, most HR first, ...).
+         */
+        std::vector<std::pair<Player*, double>> getLeaders(StatId stat, int topN = 10);
+        std::vector<std::pair<Player*, double>> getLeaders(StatId stat, int topN, bool ascending);
+
+        /**
+         * Rate-stat leaders among qualified players only: at least qualifyingMinimum(stat, teamGames)
+         * plate appearances (batting rates) or innings (pitching rates). Unqualified rows are
+         * masked out before selection, so they're never sorted and never returned. Counting
+         * stats (HR, RBI) have no minimum.
+         */
+        std::vector<std::pair<Player*, double>> getQualifiedLeaders(const std::string& stat,
+            int topN, int teamGames);
+        std::vector<std::pair<Player*, double>> getQualifiedLeaders(StatId stat, int topN, int teamGames);
+        std::vector<std::pair<Player*, double>> getQualifiedLeaders(StatId stat, int topN, int teamGames,
+            bool ascending);
+
+        // ----------------------------------------------------------------
+        // Maintained leaderboards (live tickers)
+        // ----------------------------------------------------------------
+        /**
+         * Keep a leaderboard for 'stat' sorted from now on. Returns a subscription ID.
+         * The board follows registerPlayer/unregisterPlayer, notifyStatsChanged (one player,
+         * O(log n) per board) and refreshStats (everyone).
+         */
+        int subscribeLeaderboard(StatId stat);
+        int subscribeLeaderboard(StatId stat, bool ascending);
+        void unsubscribeLeaderboard(int subscription);
+
+        /**
+         * The current top N of a subscribed board; no recomputation, just a walk.
+         */
+        std::vector<std::pair<Player*, double>> getSubscribedLeaders(int subscription, int topN) const;
+
+        /**
+         * Tell the manager a player's PlayerStats changed (e.g. after a game). Reloads that
+         * player's row and repositions it on every subscribed board.
+         */
+        void notifyStatsChanged(Player* player);
+
+        // ----------------------------------------------------------------
+        // Multi-season history
+        // ----------------------------------------------------------------
+        /**
+         * End of season: snapshot every registered player's row of the table into the history
+         * under 'year' ('teamGames' = the season's length, for qualification). With resetPlayerStats,
+         * each PlayerStats is then reset for the new season. Returns the season's index.
+         */
+        int archiveSeason(int year, int teamGames, bool resetPlayerStats = false);
+
+        /**
+         * Careers, splits and best seasons; history player IDs are this manager's IDs.
+         */
+        const StatsHistory& getHistory() const;
+
         /**
          * (Optional) sum or average that stat for all players on a team
-         * pass 'aggregateMethod' like "SUM" or "AVG" if you want either approach
+         * pass 'aggregateMethod' like "SUM" or "AVG" if you want either approach.
+         * Registered players' values come from the table.
          */
         double getTeamStat(Team* team,
             const std::string& stat,
             const std::string& aggregateMethod = "SUM");
+        double getTeamStat(Team* team, StatId stat, AggregateMethod method = AggregateMethod::Sum);
+
+        /**
+         * One player's current value of a stat, straight from its PlayerStats.
+         */
+        double getStatValue(Player* player, StatId stat) const;
 
         /**
          * Check and update all-time records if the players new stat surpasses it.
-         * For demonstration, we only do the "highest" approach.
+         * For demonstration, we only do the "highest" approach. Silent; for real record
+         * keeping (game/season/career, min and max, events) use the RecordBook below.
          */
         void checkAndUpdateAllTimeRecord(Player* player, const std::string& stat);
+        void checkAndUpdateAllTimeRecord(Player* player, StatId stat);
 
         /**
          * Retrieve the stored all-time record for a given stat.
          * If not found, return a default of {0.0, nullptr} or throw.
          */
         AllTimeRecord getAllTimeRecord(const std::string& stat) const;
+        AllTimeRecord getAllTimeRecord(StatId stat) const;
+
+        // ----------------------------------------------------------------
+        // Record book (bulk updates; record-broken events instead of printing)
+        // ----------------------------------------------------------------
+        /**
+         * Single-game records from a finished game's box score (registered players only).
+         */
+        void recordGame(int gameID, const BoxScore& box);
+
+        /**
+         * Season-to-date records for every registered player (from the table), e.g. at the end
+         * of each day. archiveSeason() does this (plus career records) automatically.
+         */
+        void updateSeasonRecords(int year, int teamGames);
+
+        /**
+         * Entries use this manager's player IDs (see getPlayer()).
+         */
+        RecordBook& getRecordBook();
+        const RecordBook& getRecordBook() const;
 
         /**
          * If you keep multi-season data, you might also provide a function to specify "year"
@@ -73,21 +199,59 @@ namespace BBEngine
          // double getStatForSeason(Player* player, const std::string& stat, int seasonYear);
 
     private:
-        // The list of all players we track
-        std::vector<Player*> allPlayers;
+        // Registered players by dense ID (nullptr => unregistered, the ID is not reused)
+        std::vector<Player*> playersByID;
+        std::unordered_map<Player*, int> idByPlayer;
+        int registeredCount = 0;
 
-        // A map of statName => AllTimeRecord. For example, "HR" => {73, pointerToPlayer}.
-        std::unordered_map<std::string, AllTimeRecord> allTimeRecords;
+        // Their counters, one column per stat, same IDs
+        StatsTable table;
 
-        /**
-         * Return the correct numeric value of 'stat' from the player's stats object.
-         * We'll handle known stats with if-else or a small dictionary approach.
-         */
-        double getStatValue(Player* player, const std::string& stat) const;
+        // Which PlayerStats (and which version of it) each row was loaded from
+        struct LoadedRow
+        {
+            const PlayerStats* stats = nullptr;
+            unsigned long long version = 0;
+        };
+        std::vector<LoadedRow> loadedRows;
+
+        // Reused output column for the derived-stat kernels
+        std::vector<double> statColumn;
+        std::vector<std::uint8_t> qualifiedMask;
+
+        // Subscribed leaderboards by subscription ID (nullptr => unsubscribed)
+        std::vector<std::unique_ptr<Leaderboard>> leaderboards;
+
+        // Every archived season
+        StatsHistory history;
+
+        // StatId => AllTimeRecord. For example, HR => {73, pointerToPlayer}; holder nullptr => none yet.
+        std::array<AllTimeRecord, StatIdCount> allTimeRecords{};
+
+        // Game / season / career records, and the scratch rows recordGame() fills
+        RecordBook recordBook;
+        StatsTable gameTable;
+        int totalTeamGames = 0;     // over every archived season, for career qualification
 
         /**
-         * A small helper to do the sorting logic for getLeaders.
-         * We can store ascending in the lambda or capture it.
+         * A small helper to do the sorting logic for getLeaders: the best topN of 'values'
+         * (registered players only), best first.
          */
+        std::vector<std::pair<Player*, double>> selectTop(const std::vector<double>& values,
+            int topN, bool ascending, const std::vector<std::uint8_t>* qualified = nullptr) const;
+
+        // qualified[id] for 'stat' after 'teamGames'; false => everyone qualifies, mask untouched
+        bool computeQualificationMask(StatId stat, int teamGames, std::vector<std::uint8_t>& qualified) const;
+
+        // (Re)load one row from its player's PlayerStats, or clear it if there are none
+        void loadRow(int id);
+
+        // Reload the rows whose PlayerStats changed since they were loaded (boards untouched)
+        void syncTable();
+
+        // Put every registered player on a board at their current value
+        void fillLeaderboard(Leaderboard& board);
+
+        const Leaderboard& getLeaderboard(int subscription) const;
     };
 }
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BBEngine
+{
+    class PlayerStats;
+
+    /**
+     * The integer counters of a PlayerStats, in a fixed order. Used as the column index
+     * of a StatsTable. (Innings pitched is a double and has its own column.)
+     */
+    enum class StatColumn : std::uint8_t
+    {
+        AtBats,
+        Hits,
+        Doubles,
+        Triples,
+        HomeRuns,
+        Walks,
+        Strikeouts,
+        Runs,
+        RBIs,
+        HitsAllowed,
+        RunsAllowed,
+        EarnedRuns,
+        WalksAllowed,
+        PitcherStrikeouts,
+        Wins,
+        Losses,
+        Saves,
+        Count
+    };
+
+    constexpr std::size_t StatColumnCount = static_cast<std::size_t>(StatColumn::Count);
+
+    /**
+     * Columnar counters for many players: one contiguous array per counter, indexed by a dense
+     * player ID (see StatsManager, which hands those out).
+     *
+     * The compute* kernels derive one stat for every row in a single pass into an output column.
+     * They only read two to five plain arrays and have no branches in the loop body, so the
+     * compiler can vectorize them; a 10k-player leaderboard is a few microseconds of arithmetic.
+     *
+     * Rate stats with an empty denominator follow StatsManager: 0 for AVG/OBP/SLG,
+     * NoInningsRate (99.99) for ERA/WHIP so those players sort to the bottom.
+     */
+    class StatsTable
+    {
+    public:
+        static constexpr double NoInningsRate = 99.99;
+
+        StatsTable() = default;
+
+        /**
+         * Add a row of zeros. Returns its ID (IDs are handed out 0, 1, 2, ...).
+         */
+        int addPlayer();
+
+        void reserve(std::size_t players);
+        std::size_t size() const;
+
+        /**
+         * Grow (new rows are zero) or shrink to exactly 'players' rows.
+         */
+        void resize(std::size_t players);
+
+        /**
+         * Copy a PlayerStats into a row, or zero the row.
+         */
+        void load(int playerID, const PlayerStats& stats);
+        void clearRow(int playerID);
+
+        // ----------------------------------------------------------------
+        // Cell / column access
+        // ----------------------------------------------------------------
+        int get(StatColumn column, int playerID) const;
+        void set(StatColumn column, int playerID, int value);
+        void add(StatColumn column, int playerID, int count);
+
+        double getInningsPitched(int playerID) const;
+        void setInningsPitched(int playerID, double innings);
+        void addInningsPitched(int playerID, double innings);
+
+        const std::int32_t* column(StatColumn column) const;
+        const double* inningsPitchedColumn() const;
+
+        // ----------------------------------------------------------------
+        // Derived-stat kernels: out[id] for every row, out is resized to size()
+        // ----------------------------------------------------------------
+        void computeCounter(StatColumn column, std::vector<double>& out) const;
+        void computeBattingAverage(std::vector<double>& out) const;
+        void computeOnBasePercentage(std::vector<double>& out) const;
+        void computeSlugging(std::vector<double>& out) const;
+        void computeOPS(std::vector<double>& out) const;    ///< OBP + SLG in one pass
+        void computeERA(std::vector<double>& out) const;
+        void computeWHIP(std::vector<double>& out) const;
+
+        // ----------------------------------------------------------------
+        // Qualification
+        // ----------------------------------------------------------------
+        /**
+         * mask[id] = 1 if the row has at least 'minimum' plate appearances (AB + BB; HBP and
+         * sacrifices aren't tracked), 0 otherwise. mask is resized to size().
+         */
+        void computePlateAppearanceMask(double minimum, std::vector<std::uint8_t>& mask) const;
+
+        /**
+         * mask[id] = 1 if the row has at least 'minimum' innings pitched.
+         */
+        void computeInningsPitchedMask(double minimum, std::vector<std::uint8_t>& mask) const;
+
+    private:
+        std::vector<std::int32_t> columns[StatColumnCount];
+        std::vector<double> inningsPitched;
+    };
+
+} // namespace BBEngine
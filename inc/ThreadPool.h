@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BBEngine
+{
+    /**
+     * A small fixed-size thread pool for fork/join style work, e.g. all of a day's games.
+     *
+     * The calling thread takes part in the work as worker 0, so a pool of N workers
+     * spawns N-1 threads, and a pool of 1 runs everything inline.
+     * Each task is told which worker runs it, so callers can keep per-worker state
+     * (like one Simulator per thread) without any locking.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * threadCount <= 0 => use std::thread::hardware_concurrency().
+         */
+        explicit ThreadPool(int threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * Total number of workers, including the calling thread.
+         */
+        int getThreadCount() const;
+
+        /**
+         * Run task(index, workerIndex) for every index in [0, count) and wait for all of them.
+         * workerIndex is in [0, getThreadCount()). If any task throws, the first exception
+         * is rethrown here once every task has finished; the other tasks still run, whether
+         * the pool has one worker or many.
+         * Not re-entrant: don't call parallelFor from inside a task.
+         */
+        void parallelFor(std::size_t count, const std::function<void(std::size_t, int)>& task);
+
+    private:
+        void workerLoop(int workerIndex);
+        void runTasks(int workerIndex);
+
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+        std::condition_variable workReady;
+        std::condition_variable workDone;
+
+        // The current job, guarded by 'mutex' except for the atomics
+        const std::function<void(std::size_t, int)>* currentTask;
+        std::size_t taskCount;
+        std::atomic<std::size_t> nextIndex;
+        unsigned long long generation;
+        int busyWorkers;
+        bool stopping;
+        std::exception_ptr firstError;
+    };
+
+} // namespace BBEngine
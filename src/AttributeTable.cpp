@@ -0,0 +1,174 @@
+#include "AttributeTable.h"
+#include "PlayerAttributes.h"
+#include <stdexcept>
+
+namespace BBEngine
+{
+    // -------------------------------------------------------
+    // Rows
+    // -------------------------------------------------------
+    int AttributeTable::addPlayer()
+    {
+        for (auto& col : columns)
+            col.push_back(50);
+        return static_cast<int>(columns[0].size()) - 1;
+    }
+
+    int AttributeTable::addPlayer(const PlayerAttributes& initial)
+    {
+        for (std::size_t a = 0; a < AttributeCount; ++a)
+            columns[a].push_back(clampRating(initial.get(static_cast<Attribute>(a))));
+        return static_cast<int>(columns[0].size()) - 1;
+    }
+
+    void AttributeTable::reserve(std::size_t players)
+    {
+        for (auto& col : columns)
+            col.reserve(players);
+    }
+
+    std::size_t AttributeTable::size() const
+    {
+        return columns[0].size();
+    }
+
+    bool AttributeTable::empty() const
+    {
+        return columns[0].empty();
+    }
+
+    // -------------------------------------------------------
+    // Cell / column access
+    // -------------------------------------------------------
+    int AttributeTable::get(Attribute attribute, int playerID) const
+    {
+        return columns[static_cast<std::size_t>(attribute)][playerID];
+    }
+
+    void AttributeTable::set(Attribute attribute, int playerID, int value)
+    {
+        columns[static_cast<std::size_t>(attribute)][playerID] = clampRating(value);
+    }
+
+    const std::uint8_t* AttributeTable::column(Attribute attribute) const
+    {
+        return columns[static_cast<std::size_t>(attribute)].data();
+    }
+
+    std::uint8_t* AttributeTable::column(Attribute attribute)
+    {
+        return columns[static_cast<std::size_t>(attribute)].data();
+    }
+
+    // -------------------------------------------------------
+    // Bulk operations
+    //
+    // Each loop reads/writes plain uint8_t arrays with no branches in the body,
+    // which is what lets the compiler turn them into vector instructions.
+    // -------------------------------------------------------
+    void AttributeTable::ageOneYear()
+    {
+        const std::size_t n = size();
+        std::uint8_t* velocity = column(Attribute::PitchVelocity);
+        std::uint8_t* control = column(Attribute::PitchControl);
+        std::uint8_t* durability = column(Attribute::Durability);
+
+        for (std::size_t i = 0; i < n; ++i)
+            velocity[i] = static_cast<std::uint8_t>(velocity[i] > 1 ? velocity[i] - 1 : 1);
+        for (std::size_t i = 0; i < n; ++i)
+            control[i] = static_cast<std::uint8_t>(control[i] < 99 ? control[i] + 1 : 99);
+        for (std::size_t i = 0; i < n; ++i)
+            durability[i] = static_cast<std::uint8_t>(durability[i] > 1 ? durability[i] - 1 : 1);
+    }
+
+    void AttributeTable::clampAllAttributes()
+    {
+        for (auto& col : columns)
+        {
+            std::uint8_t* v = col.data();
+            const std::size_t n = col.size();
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                std::uint8_t x = v[i] < 1 ? 1 : v[i];
+                v[i] = x > 99 ? 99 : x;
+            }
+        }
+    }
+
+    void AttributeTable::averageHittingRatings(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const std::uint8_t* contact = column(Attribute::Contact);
+        const std::uint8_t* power = column(Attribute::Power);
+        const std::uint8_t* discipline = column(Attribute::PlateDiscipline);
+
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = static_cast<double>(contact[i] + power[i] + discipline[i]) / 3.0;
+    }
+
+    void AttributeTable::averagePitchingRatings(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const std::uint8_t* velocity = column(Attribute::PitchVelocity);
+        const std::uint8_t* control = column(Attribute::PitchControl);
+        const std::uint8_t* movement = column(Attribute::PitchMovement);
+
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = static_cast<double>(velocity[i] + control[i] + movement[i]) / 3.0;
+    }
+
+    std::vector<int> AttributeTable::findPlayers(Attribute attribute, int minValue) const
+    {
+        return findPlayers(std::vector<AttributeThreshold>{ { attribute, minValue } });
+    }
+
+    std::vector<int> AttributeTable::findPlayers(const std::vector<AttributeThreshold>& thresholds) const
+    {
+        const std::size_t n = size();
+        std::vector<std::uint8_t> mask(n, 1);
+
+        for (const AttributeThreshold& t : thresholds)
+        {
+            if (t.attribute == Attribute::Count)
+                throw std::invalid_argument("AttributeThreshold needs a real attribute.");
+
+            // Anything <= 1 matches every rating, anything > 99 matches none
+            if (t.minValue <= 1)
+                continue;
+            if (t.minValue > 99)
+                return {};
+
+            const std::uint8_t minValue = static_cast<std::uint8_t>(t.minValue);
+            const std::uint8_t* v = column(t.attribute);
+            std::uint8_t* m = mask.data();
+            for (std::size_t i = 0; i < n; ++i)
+                m[i] &= static_cast<std::uint8_t>(v[i] >= minValue);
+        }
+
+        return collectMatches(mask);
+    }
+
+    // -------------------------------------------------------
+    // Private Helpers
+    // -------------------------------------------------------
+    std::uint8_t AttributeTable::clampRating(int raw)
+    {
+        if (raw < 1)  return 1;
+        if (raw > 99) return 99;
+        return static_cast<std::uint8_t>(raw);
+    }
+
+    std::vector<int> AttributeTable::collectMatches(const std::vector<std::uint8_t>& mask)
+    {
+        std::vector<int> ids;
+        for (std::size_t i = 0; i < mask.size(); ++i)
+        {
+            if (mask[i])
+                ids.push_back(static_cast<int>(i));
+        }
+        return ids;
+    }
+
+} // namespace BBEngine
@@ -8,10 +8,70 @@ namespace BBEngine
     // Constructor
     // -------------------------------------------------
     BoxScore::BoxScore(const std::string& homeTeamName,
-        const std::string& awayTeamName)
+        const std::string& awayTeamName,
+        std::pmr::memory_resource* resource)
         : homeTeam(homeTeamName),
-        awayTeam(awayTeamName)
+        awayTeam(awayTeamName),
+        homeBattingLines(resource),
+        awayBattingLines(resource),
+        homePitchingLines(resource),
+        awayPitchingLines(resource),
+        homeTeamRuns(0),
+        awayTeamRuns(0),
+        homeTeamHits(0),
+        awayTeamHits(0),
+        homeTeamErrors(0),
+        awayTeamErrors(0),
+        homeLineScore(resource),
+        awayLineScore(resource),
+        currentInning(1),
+        foldLineScore(false)
+    {
+        // Reserve the full capacity now so lines never move during a game
+        homeBattingLines.reserve(MaxBattersPerSide);
+        awayBattingLines.reserve(MaxBattersPerSide);
+        homePitchingLines.reserve(MaxPitchersPerSide);
+        awayPitchingLines.reserve(MaxPitchersPerSide);
+        homeLineScore.reserve(12);
+        awayLineScore.reserve(12);
+    }
+
+    BoxScore::BoxScore(const BoxScore& other)
+        : BoxScore(other.homeTeam, other.awayTeam)
     {
+        *this = other;
+    }
+
+    BoxScore& BoxScore::operator=(const BoxScore& other)
+    {
+        if (this == &other)
+            return *this;
+
+        homeTeam = other.homeTeam;
+        awayTeam = other.awayTeam;
+
+        // Assigning into a vector that already has the room keeps its buffer
+        homeBattingLines.reserve(MaxBattersPerSide);
+        awayBattingLines.reserve(MaxBattersPerSide);
+        homePitchingLines.reserve(MaxPitchersPerSide);
+        awayPitchingLines.reserve(MaxPitchersPerSide);
+        homeBattingLines = other.homeBattingLines;
+        awayBattingLines = other.awayBattingLines;
+        homePitchingLines = other.homePitchingLines;
+        awayPitchingLines = other.awayPitchingLines;
+
+        homeTeamRuns = other.homeTeamRuns;
+        awayTeamRuns = other.awayTeamRuns;
+        homeTeamHits = other.homeTeamHits;
+        awayTeamHits = other.awayTeamHits;
+        homeTeamErrors = other.homeTeamErrors;
+        awayTeamErrors = other.awayTeamErrors;
+
+        homeLineScore = other.homeLineScore;
+        awayLineScore = other.awayLineScore;
+        currentInning = other.currentInning;
+        foldLineScore = other.foldLineScore;
+        return *this;
     }
 
     const std::string& BoxScore::getHomeTeamName() const { return homeTeam; }
@@ -20,47 +80,117 @@ namespace BBEngine
     void BoxScore::setHomeTeamName(const std::string& name) { homeTeam = name; }
     void BoxScore::setAwayTeamName(const std::string& name) { awayTeam = name; }
 
-    // -------------------------------------------------
-    // Manage Batting Lines
-    // -------------------------------------------------
-    void BoxScore::addBatterToLineup(bool isHome, Player* player)
+    void BoxScore::reset(const std::string& homeTeamName,
+        const std::string& awayTeamName)
     {
-        if (!player)
-            throw std::invalid_argument("Player pointer is null.");
+        homeTeam = homeTeamName;
+        awayTeam = awayTeamName;
+
+        // clear() keeps the capacity, which is the whole point of reusing the object
+        homeBattingLines.clear();
+        awayBattingLines.clear();
+        homePitchingLines.clear();
+        awayPitchingLines.clear();
+
+        homeTeamRuns = awayTeamRuns = 0;
+        homeTeamHits = awayTeamHits = 0;
+        homeTeamErrors = awayTeamErrors = 0;
+        homeLineScore.clear();
+        awayLineScore.clear();
+        currentInning = 1;
+        foldLineScore = false;
+    }
 
-        // We'll store in the appropriate vector:
-        if (isHome)
+    BoxScoreTotals BoxScore::getTotals() const
+    {
+        BoxScoreTotals totals;
+        totals.homeRuns = homeTeamRuns;
+        totals.awayRuns = awayTeamRuns;
+        totals.homeHits = homeTeamHits;
+        totals.awayHits = awayTeamHits;
+        totals.homeErrors = homeTeamErrors;
+        totals.awayErrors = awayTeamErrors;
+
+        // Extra innings past the last column are folded into it. A box that's already folding
+        // still counts every inning it has played, so its own totals keep folding too.
+        std::size_t innings = std::max(homeLineScore.size(), awayLineScore.size());
+        if (foldLineScore)
+            innings = std::max(innings, static_cast<std::size_t>(currentInning));
+        totals.innings = static_cast<std::uint16_t>(innings);
+        for (std::size_t i = 0; i < innings; ++i)
         {
-            // Check if there's an existing line for this player
-            auto it = std::find_if(homeBattingLines.begin(), homeBattingLines.end(),
-                [player](const BoxScoreBattingLine& line) {
-                    return line.player == player;
-                });
+            const std::size_t column = std::min(i, static_cast<std::size_t>(BoxScoreTotals::LineScoreInnings - 1));
+            if (i < homeLineScore.size())
+                totals.homeLineScore[column] = static_cast<std::uint8_t>(totals.homeLineScore[column] + homeLineScore[i]);
+            if (i < awayLineScore.size())
+                totals.awayLineScore[column] = static_cast<std::uint8_t>(totals.awayLineScore[column] + awayLineScore[i]);
+        }
+        return totals;
+    }
 
-            if (it != homeBattingLines.end())
+    void BoxScore::seedTotals(const BoxScoreTotals& totals)
+    {
+        for (auto* lines : { &homeBattingLines, &awayBattingLines })
+        {
+            for (BoxScoreBattingLine& line : *lines)
             {
-                // Already in the lineup, do nothing or throw
-                return;
+                Player* player = line.player;
+                line = BoxScoreBattingLine();
+                line.player = player;
             }
-
-            BoxScoreBattingLine newLine;
-            newLine.player = player;
-            homeBattingLines.push_back(newLine);
         }
-        else
+        for (auto* lines : { &homePitchingLines, &awayPitchingLines })
         {
-            auto it = std::find_if(awayBattingLines.begin(), awayBattingLines.end(),
-                [player](const BoxScoreBattingLine& line) {
-                    return line.player == player;
-                });
-            if (it != awayBattingLines.end())
+            for (BoxScorePitchingLine& line : *lines)
             {
-                return;
+                Player* pitcher = line.pitcher;
+                line = BoxScorePitchingLine();
+                line.pitcher = pitcher;
             }
-            BoxScoreBattingLine newLine;
-            newLine.player = player;
-            awayBattingLines.push_back(newLine);
         }
+
+        homeTeamRuns = totals.homeRuns;
+        awayTeamRuns = totals.awayRuns;
+        homeTeamHits = totals.homeHits;
+        awayTeamHits = totals.awayHits;
+        homeTeamErrors = totals.homeErrors;
+        awayTeamErrors = totals.awayErrors;
+
+        homeLineScore.clear();
+        awayLineScore.clear();
+        const int columns = std::min<int>(totals.innings, BoxScoreTotals::LineScoreInnings);
+        for (int i = 0; i < columns; ++i)
+        {
+            homeLineScore.push_back(totals.homeLineScore[i]);
+            awayLineScore.push_back(totals.awayLineScore[i]);
+        }
+        currentInning = 1;
+        foldLineScore = (totals.innings > BoxScoreTotals::LineScoreInnings);
+        if (totals.innings > 0)
+            setCurrentInning(totals.innings);
+    }
+
+    // -------------------------------------------------
+    // Manage Batting Lines
+    // -------------------------------------------------
+    int BoxScore::addBatterToLineup(bool isHome, Player* player)
+    {
+        if (!player)
+            throw std::invalid_argument("Player pointer is null.");
+
+        // Already in the lineup => hand back the existing slot; otherwise this creates the line
+        return findBattingSlot(isHome, player);
+    }
+
+    int BoxScore::getBattingSlot(bool isHome, Player* player) const
+    {
+        const auto& lines = (isHome ? homeBattingLines : awayBattingLines);
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            if (lines[i].player == player)
+                return static_cast<int>(i);
+        }
+        return -1;
     }
 
     void BoxScore::recordAtBat(bool isHome,
@@ -79,7 +209,23 @@ namespace BBEngine
             throw std::invalid_argument("Batter pointer is null.");
 
         // get or create the correct BoxScoreBattingLine
-        BoxScoreBattingLine& line = findBattingLine(isHome, batter);
+        recordAtBatInSlot(isHome, findBattingSlot(isHome, batter), atBats, hits, doubles_, triples, homeRuns,
+            runsBattedIn, walks, strikeouts, runsScored);
+    }
+
+    void BoxScore::recordAtBatInSlot(bool isHome,
+        int slot,
+        int atBats,
+        int hits,
+        int doubles_,
+        int triples,
+        int homeRuns,
+        int runsBattedIn,
+        int walks,
+        int strikeouts,
+        int runsScored)
+    {
+        BoxScoreBattingLine& line = (isHome ? homeBattingLines : awayBattingLines)[slot];
 
         line.atBats += atBats;
         line.hits += hits;
@@ -90,6 +236,18 @@ namespace BBEngine
         line.walks += walks;
         line.strikeouts += strikeouts;
         line.runsScored += runsScored;
+
+        // Keep the team totals and the line score in step
+        (isHome ? homeTeamHits : awayTeamHits) += hits;
+        if (runsScored != 0)
+        {
+            (isHome ? homeTeamRuns : awayTeamRuns) += runsScored;
+            std::pmr::vector<int>& lineScore = (isHome ? homeLineScore : awayLineScore);
+            const int columns = lineScoreColumns();
+            if (lineScore.size() < static_cast<size_t>(columns))
+                lineScore.resize(columns, 0);
+            lineScore[columns - 1] += runsScored;
+        }
     }
 
     void BoxScore::recordWalk(bool isHome, Player* batter)
@@ -118,6 +276,16 @@ namespace BBEngine
         );
     }
 
+    void BoxScore::recordWalkInSlot(bool isHome, int slot)
+    {
+        recordAtBatInSlot(isHome, slot, 0, 0, 0, 0, 0, 0, 1, 0, 0);
+    }
+
+    void BoxScore::recordStrikeoutInSlot(bool isHome, int slot)
+    {
+        recordAtBatInSlot(isHome, slot, 1, 0, 0, 0, 0, 0, 0, 1, 0);
+    }
+
     void BoxScore::recordHit(bool isHome, Player* batter,
         bool isDouble,
         bool isTriple,
@@ -142,75 +310,110 @@ namespace BBEngine
         );
     }
 
-    const std::vector<BoxScoreBattingLine>& BoxScore::getHomeBattingLines() const
+    const std::pmr::vector<BoxScoreBattingLine>& BoxScore::getHomeBattingLines() const
     {
         return homeBattingLines;
     }
 
-    const std::vector<BoxScoreBattingLine>& BoxScore::getAwayBattingLines() const
+    const std::pmr::vector<BoxScoreBattingLine>& BoxScore::getAwayBattingLines() const
     {
         return awayBattingLines;
     }
 
     int BoxScore::getHomeTeamRuns() const
     {
-        int total = 0;
-        for (const auto& line : homeBattingLines)
-        {
-            total += line.runsScored;
-        }
-        return total;
+        return homeTeamRuns;
     }
 
     int BoxScore::getAwayTeamRuns() const
     {
-        int total = 0;
-        for (const auto& line : awayBattingLines)
-        {
-            total += line.runsScored;
-        }
-        return total;
+        return awayTeamRuns;
+    }
+
+    int BoxScore::getHomeTeamHits() const
+    {
+        return homeTeamHits;
+    }
+
+    int BoxScore::getAwayTeamHits() const
+    {
+        return awayTeamHits;
+    }
+
+    // -------------------------------------------------
+    // Innings & Line Score
+    // -------------------------------------------------
+    void BoxScore::setCurrentInning(int inning)
+    {
+        if (inning < 1)
+            throw std::invalid_argument("Inning must be 1 or later.");
+
+        currentInning = inning;
+
+        // Every inning that has started gets a column for both teams, even if nobody scores
+        const int columns = lineScoreColumns();
+        if (homeLineScore.size() < static_cast<size_t>(columns))
+            homeLineScore.resize(columns, 0);
+        if (awayLineScore.size() < static_cast<size_t>(columns))
+            awayLineScore.resize(columns, 0);
+    }
+
+    int BoxScore::lineScoreColumns() const
+    {
+        return foldLineScore ? std::min(currentInning, BoxScoreTotals::LineScoreInnings) : currentInning;
+    }
+
+    int BoxScore::getCurrentInning() const
+    {
+        return currentInning;
+    }
+
+    void BoxScore::recordError(bool isHome, int count)
+    {
+        (isHome ? homeTeamErrors : awayTeamErrors) += count;
+    }
+
+    int BoxScore::getHomeTeamErrors() const
+    {
+        return homeTeamErrors;
+    }
+
+    int BoxScore::getAwayTeamErrors() const
+    {
+        return awayTeamErrors;
+    }
+
+    const std::pmr::vector<int>& BoxScore::getHomeLineScore() const
+    {
+        return homeLineScore;
+    }
+
+    const std::pmr::vector<int>& BoxScore::getAwayLineScore() const
+    {
+        return awayLineScore;
     }
 
     // -------------------------------------------------
     // Manage Pitching Lines
     // -------------------------------------------------
-    void BoxScore::addPitcher(bool isHome, Player* pitcher)
+    int BoxScore::addPitcher(bool isHome, Player* pitcher)
     {
         if (!pitcher)
             throw std::invalid_argument("Pitcher pointer is null.");
 
-        if (isHome)
-        {
-            // Check if pitcher is already in the lines
-            auto it = std::find_if(homePitchingLines.begin(), homePitchingLines.end(),
-                [pitcher](const BoxScorePitchingLine& line) {
-                    return line.pitcher == pitcher;
-                });
-            if (it != homePitchingLines.end())
-            {
-                return; // pitcher already present
-            }
+        // pitcher already present => the existing slot; otherwise a new line
+        return findPitchingSlot(isHome, pitcher);
+    }
 
-            BoxScorePitchingLine line;
-            line.pitcher = pitcher;
-            homePitchingLines.push_back(line);
-        }
-        else
+    int BoxScore::getPitchingSlot(bool isHome, Player* pitcher) const
+    {
+        const auto& lines = (isHome ? homePitchingLines : awayPitchingLines);
+        for (std::size_t i = 0; i < lines.size(); ++i)
         {
-            auto it = std::find_if(awayPitchingLines.begin(), awayPitchingLines.end(),
-                [pitcher](const BoxScorePitchingLine& line) {
-                    return line.pitcher == pitcher;
-                });
-            if (it != awayPitchingLines.end())
-            {
-                return;
-            }
-
-            BoxScorePitchingLine line;
-            line.pitcher = pitcher;
-            awayPitchingLines.push_back(line);
+            if (lines[i].pitcher == pitcher)
+                return static_cast<int>(i);
         }
+        return -1;
     }
 
     void BoxScore::recordPitching(bool isHome,
@@ -225,7 +428,20 @@ namespace BBEngine
         if (!pitcher)
             throw std::invalid_argument("Pitcher pointer is null.");
 
-        BoxScorePitchingLine& line = findPitchingLine(isHome, pitcher);
+        recordPitchingInSlot(isHome, findPitchingSlot(isHome, pitcher), inningsPitchedDelta, hitsAllowed, runsAllowed,
+            earnedRuns, walksAllowed, strikeouts);
+    }
+
+    void BoxScore::recordPitchingInSlot(bool isHome,
+        int slot,
+        double inningsPitchedDelta,
+        int hitsAllowed,
+        int runsAllowed,
+        int earnedRuns,
+        int walksAllowed,
+        int strikeouts)
+    {
+        BoxScorePitchingLine& line = (isHome ? homePitchingLines : awayPitchingLines)[slot];
 
         line.inningsPitched += inningsPitchedDelta;
         line.hitsAllowed += hitsAllowed;
@@ -241,18 +457,18 @@ namespace BBEngine
         bool loss,
         bool save)
     {
-        BoxScorePitchingLine& line = findPitchingLine(isHome, pitcher);
+        BoxScorePitchingLine& line = (isHome ? homePitchingLines : awayPitchingLines)[findPitchingSlot(isHome, pitcher)];
         line.decisionWin = win;
         line.decisionLoss = loss;
         line.decisionSave = save;
     }
 
-    const std::vector<BoxScorePitchingLine>& BoxScore::getHomePitchingLines() const
+    const std::pmr::vector<BoxScorePitchingLine>& BoxScore::getHomePitchingLines() const
     {
         return homePitchingLines;
     }
 
-    const std::vector<BoxScorePitchingLine>& BoxScore::getAwayPitchingLines() const
+    const std::pmr::vector<BoxScorePitchingLine>& BoxScore::getAwayPitchingLines() const
     {
         return awayPitchingLines;
     }
@@ -260,52 +476,43 @@ namespace BBEngine
     // -------------------------------------------------
     // Private Helpers
     // -------------------------------------------------
-    BoxScoreBattingLine& BoxScore::findBattingLine(bool isHome, Player* player)
+    int BoxScore::findBattingSlot(bool isHome, Player* player)
     {
-        std::vector<BoxScoreBattingLine>* lines = (isHome ? &homeBattingLines : &awayBattingLines);
+        std::pmr::vector<BoxScoreBattingLine>& lines = (isHome ? homeBattingLines : awayBattingLines);
 
         // Try to find an existing line for this player
-        auto it = std::find_if(lines->begin(), lines->end(),
-            [player](BoxScoreBattingLine& line) {
-                return line.player == player;
-            });
-
-        if (it == lines->end())
-        {
-            // If not found, create a new one
-            BoxScoreBattingLine newLine;
-            newLine.player = player;
-            lines->push_back(newLine);
-            return lines->back();
-        }
-        else
-        {
-            return *it;
-        }
+        int existing = getBattingSlot(isHome, player);
+        if (existing >= 0)
+            return existing;
+
+        // If not found, create a new one; never past the reserved capacity, so nothing moves
+        if (lines.size() >= static_cast<size_t>(MaxBattersPerSide))
+            throw std::length_error("BoxScore has no batting slots left for this side.");
+
+        int slot = static_cast<int>(lines.size());
+        BoxScoreBattingLine newLine;
+        newLine.player = player;
+        lines.push_back(newLine);
+        return slot;
     }
 
-    BoxScorePitchingLine& BoxScore::findPitchingLine(bool isHome, Player* pitcher)
+    int BoxScore::findPitchingSlot(bool isHome, Player* pitcher)
     {
-        std::vector<BoxScorePitchingLine>* lines = (isHome ? &homePitchingLines : &awayPitchingLines);
+        std::pmr::vector<BoxScorePitchingLine>& lines = (isHome ? homePitchingLines : awayPitchingLines);
 
         // find existing
-        auto it = std::find_if(lines->begin(), lines->end(),
-            [pitcher](BoxScorePitchingLine& line) {
-                return line.pitcher == pitcher;
-            });
-
-        if (it == lines->end())
-        {
-            // If not found, create a new one
-            BoxScorePitchingLine newLine;
-            newLine.pitcher = pitcher;
-            lines->push_back(newLine);
-            return lines->back();
-        }
-        else
-        {
-            return *it;
-        }
+        int existing = getPitchingSlot(isHome, pitcher);
+        if (existing >= 0)
+            return existing;
+
+        if (lines.size() >= static_cast<size_t>(MaxPitchersPerSide))
+            throw std::length_error("BoxScore has no pitching slots left for this side.");
+
+        int slot = static_cast<int>(lines.size());
+        BoxScorePitchingLine newLine;
+        newLine.pitcher = pitcher;
+        lines.push_back(newLine);
+        return slot;
     }
 
 } // namespace BBEngine
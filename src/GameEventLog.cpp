@@ -0,0 +1,47 @@
+#include "GameEventLog.h"
+
+namespace BBEngine
+{
+    GameEventLog::GameEventLog(std::size_t capacity)
+        : gameID(-1)
+    {
+        events.reserve(capacity);
+    }
+
+    void GameEventLog::clear(int newGameID)
+    {
+        events.clear();
+        gameID = newGameID;
+    }
+
+    void GameEventLog::reserve(std::size_t capacity)
+    {
+        events.reserve(capacity);
+    }
+
+    int GameEventLog::getGameID() const
+    {
+        return gameID;
+    }
+
+    std::size_t GameEventLog::size() const
+    {
+        return events.size();
+    }
+
+    bool GameEventLog::empty() const
+    {
+        return events.empty();
+    }
+
+    std::size_t GameEventLog::getBytes() const
+    {
+        return events.size() * sizeof(PitchEvent);
+    }
+
+    const std::vector<PitchEvent>& GameEventLog::getEvents() const
+    {
+        return events;
+    }
+
+} // namespace BBEngine
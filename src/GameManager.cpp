@@ -1,6 +1,7 @@
 #include "GameManager.h"
-#include <iostream>
+#include "Log.h"
 #include <cassert>
+#include <stdexcept>
 
 namespace BBEngine
 {
@@ -12,33 +13,167 @@ namespace BBEngine
         awayTeam(away),
         boxScore(box),
         simulator(sim),
-        inning(1),
-        topOfInning(true),
-        outs(0),
-        gameOver(false),
-        runnerOnFirst(false),
-        runnerOnSecond(false),
-        runnerOnThird(false),
-        homeBatterIndex(0),
-        awayBatterIndex(0)
+        eventLog(nullptr)
     {
         // We assume teams, boxscore, simulator are not null in this example
         // or we'd add checks/throws.
+        refreshLineups();
     }
 
     bool GameManager::isGameOver() const
     {
-        return gameOver;
+        return state.gameOver;
     }
 
     int GameManager::getCurrentInning() const
     {
-        return inning;
+        return state.inning;
     }
 
     bool GameManager::isTopOfInning() const
     {
-        return topOfInning;
+        return state.topOfInning;
+    }
+
+    const GameState& GameManager::getState() const
+    {
+        return state;
+    }
+
+    void GameManager::setState(const GameState& newState)
+    {
+        state = newState;
+    }
+
+    // ----------------------------------------------------
+    // Snapshots
+    // ----------------------------------------------------
+    GameSnapshot GameManager::takeSnapshot() const
+    {
+        GameSnapshot snapshot;
+        snapshot.state = state;
+        if (boxScore)
+            snapshot.totals = boxScore->getTotals();
+        snapshot.pitchers[0] = sides[0].pitcher;
+        snapshot.pitchers[1] = sides[1].pitcher;
+        if (simulator)
+        {
+            snapshot.rngSeed = simulator->getSeed();
+            snapshot.rngStream = simulator->getRandomEngine().getStream();
+            snapshot.pitchIndex = simulator->getPitchIndex();
+        }
+        return snapshot;
+    }
+
+    void GameManager::restoreSnapshot(const GameSnapshot& snapshot)
+    {
+        state = snapshot.state;
+        for (int side = 0; side < 2; ++side)
+        {
+            if (sides[side].pitcher != snapshot.pitchers[side])
+                changePitcher(side == 1, snapshot.pitchers[side]);
+        }
+        if (boxScore)
+        {
+            boxScore->seedTotals(snapshot.totals);
+            boxScore->setCurrentInning(state.inning);
+        }
+        if (simulator)
+        {
+            simulator->setRandomEngine(CounterRng(snapshot.rngSeed, snapshot.rngStream));
+            simulator->setPitchIndex(snapshot.pitchIndex);
+        }
+    }
+
+    void GameManager::setEventLog(GameEventLog* log)
+    {
+        eventLog = log;
+    }
+
+    GameEventLog* GameManager::getEventLog() const
+    {
+        return eventLog;
+    }
+
+    // ----------------------------------------------------
+    // Resolving rosters
+    // ----------------------------------------------------
+    void GameManager::refreshLineups()
+    {
+        resolveSide(sides[0], awayTeam, false);
+        resolveSide(sides[1], homeTeam, true);
+    }
+
+    void GameManager::changePitcher(bool home, Player* newPitcher)
+    {
+        ResolvedSide& side = sides[home ? 1 : 0];
+        side.pitcher = newPitcher;
+        PlayerAttributes* attr = newPitcher ? newPitcher->getAttributes() : nullptr;
+        side.pitcherHasAttributes = (attr != nullptr);
+        side.pitcherRatings = attr ? PitcherRatings::from(*attr) : PitcherRatings();
+    }
+
+    Player* GameManager::getCurrentPitcher(bool home) const
+    {
+        return sides[home ? 1 : 0].pitcher;
+    }
+
+    void GameManager::substituteBatter(bool home, int spot, Player* newBatter)
+    {
+        ResolvedSide& side = sides[home ? 1 : 0];
+        if (spot < 0 || spot >= side.lineupSize)
+            throw std::out_of_range("[GameManager] No such lineup spot.");
+        if (!newBatter)
+            throw std::invalid_argument("[GameManager] substituteBatter needs a player.");
+        resolveBatter(side.lineup[spot], newBatter, home);
+    }
+
+    Player* GameManager::getBatter(bool home, int spot) const
+    {
+        const ResolvedSide& side = sides[home ? 1 : 0];
+        if (spot < 0 || spot >= side.lineupSize)
+            throw std::out_of_range("[GameManager] No such lineup spot.");
+        return side.lineup[spot].player;
+    }
+
+    void GameManager::resolveBatter(LineupSlot& slot, Player* player, bool home)
+    {
+        slot.player = player;
+        slot.boxSlot = (boxScore && player) ? boxScore->addBatterToLineup(home, player) : -1;
+        PlayerAttributes* attr = player ? player->getAttributes() : nullptr;
+        slot.hasAttributes = (attr != nullptr);
+        slot.ratings = attr ? BatterRatings::from(*attr) : BatterRatings();
+    }
+
+    void GameManager::resolveSide(ResolvedSide& side, Team* team, bool home)
+    {
+        side.lineupSize = 0;
+        side.pitcher = nullptr;
+        side.pitcherHasAttributes = false;
+        if (!team)
+            return;
+
+        // We'll do a naive approach: always the lineup vs RHP.
+        // In reality, you'd check the actual pitcher handedness, but let's skip that for brevity.
+        const auto& lineup = team->getLineupVsRHP();
+        if (lineup.size() > static_cast<size_t>(MaxLineupSize))
+        {
+            BB_LOG_WARNING("[GameManager] Lineup for " << team->getName() << " has " << lineup.size()
+                << " players; at most " << MaxLineupSize << " are supported.");
+        }
+        else
+        {
+            for (size_t i = 0; i < lineup.size(); ++i)
+                resolveBatter(side.lineup[i], lineup[i], home);
+            side.lineupSize = static_cast<std::uint8_t>(lineup.size());
+        }
+
+        // The starter doesn't change during the game unless somebody calls changePitcher()
+        StartingRotation* rotation = team->getRotation();
+        if (rotation && !rotation->getPitchers().empty())
+        {
+            changePitcher(home, rotation->getNextStarter());
+        }
     }
 
     // ----------------------------------------------------
@@ -46,82 +181,100 @@ namespace BBEngine
     // ----------------------------------------------------
     void GameManager::runGame()
     {
-        // We'll run until gameOver is true or we decide we've done enough innings.
-        while (!gameOver)
-        {
-            runHalfInning();
-            checkGameOver();
-            if (gameOver) break;
+        // Decide once whether pitches are recorded; each loop below is compiled both ways
+        if (eventLog)
+            playGame<true>();
+        else
+            playGame<false>();
+    }
 
-            endHalfInning();
-            if (!gameOver) // if still not over, run the other half
-            {
-                runHalfInning();
-                checkGameOver();
-                endHalfInning();
-            }
+    template<bool Record>
+    void GameManager::playGame()
+    {
+        // We'll run until gameOver is true. Halves end the same way here, in playPitch() and in
+        // replayGame(), so a game resumed in any half finishes exactly like an uninterrupted one.
+        while (!state.gameOver)
+        {
+            runHalfInning<Record>();
+            finishHalfInning();
         }
 
         // By now, gameOver should be true. The boxScore likely has final results.
         // You might do a boxScore->assignPitchingDecision(...) if you track wins/losses here.
     }
 
+    bool GameManager::playPitch()
+    {
+        if (state.gameOver)
+            return false;
+
+        startHalfInning(); // only does anything before the first pitch of a half
+        if (eventLog)
+            proceedPitch<true>();
+        else
+            proceedPitch<false>();
+
+        if (state.outs >= 3 || state.gameOver)
+            finishHalfInning();
+        return !state.gameOver;
+    }
+
+    void GameManager::finishHalfInning()
+    {
+        // The one rule for ending a half: a game that ends after a top half stays in that half
+        checkGameOver();
+        if (!state.gameOver || !state.topOfInning)
+            endHalfInning();
+    }
+
     // ----------------------------------------------------
     // runHalfInning
     // ----------------------------------------------------
+    template<bool Record>
     void GameManager::runHalfInning()
     {
         // Reset outs & base runners if new half
         startHalfInning();
 
-        while (outs < 3 && !gameOver)
+        while (state.outs < 3 && !state.gameOver)
         {
-            proceedPitch();
+            proceedPitch<Record>();
         }
     }
 
     // ----------------------------------------------------
     // proceedPitch: do a single pitch
     // ----------------------------------------------------
+    template<bool Record>
     void GameManager::proceedPitch()
     {
-        // 1. Identify the next batter, pitcher, etc.
-        bool isHomeBatting = !topOfInning; // if topOfInning=true => away is batting
-        Team* battingTeam = (isHomeBatting ? homeTeam : awayTeam);
-        Team* fieldingTeam = (isHomeBatting ? awayTeam : homeTeam);
+        // 1. Identify the next batter, pitcher, etc. Both come from the resolved sides,
+        //    so this touches only GameManager's own memory.
+        const bool isHomeBatting = !state.topOfInning; // if topOfInning=true => away is batting
+        const ResolvedSide& batting = sides[isHomeBatting ? 1 : 0];
+        const ResolvedSide& fielding = sides[isHomeBatting ? 0 : 1];
 
-        // We'll get the next batter from the correct lineup. We'll do a naive approach: always vsRHP
-        // In reality, you'd check the actual pitcher handedness, but let's skip that for brevity.
-        int& batterIndex = (isHomeBatting ? homeBatterIndex : awayBatterIndex);
-        const auto& lineup = battingTeam->getLineupVsRHP();
-        if (lineup.empty())
+        if (batting.lineupSize == 0)
         {
             // can't proceed if no lineup
             // we could skip or throw
-            std::cerr << "No lineup set for " << (isHomeBatting ? "Home" : "Away") << " team.\n";
-            gameOver = true;
+            BB_LOG_ERROR("[GameManager] No lineup set for " << (isHomeBatting ? "Home" : "Away") << " team.");
+            state.gameOver = true;
             return;
         }
-        Player* batter = lineup[batterIndex];
+        std::uint8_t& batterIndex = state.batterIndex[isHomeBatting ? 1 : 0];
+        const LineupSlot& batter = batting.lineup[batterIndex];
 
-        // Next, figure out the current pitcher. If we do a simple approach, the fieldingTeam's rotation->getNextStarter()
-        // But let's say we do that once per game or per half. We'll do a naive approach:
-        StartingRotation* rotation = fieldingTeam->getRotation();
-        if (!rotation || rotation->getPitchers().empty())
+        if (!fielding.pitcher)
         {
-            std::cerr << "No pitcher for fielding team.\n";
-            gameOver = true;
+            BB_LOG_ERROR("[GameManager] No pitcher for fielding team.");
+            state.gameOver = true;
             return;
         }
-        Player* pitcher = rotation->getNextStarter();
-
-        // 2. Gather attributes for simulator
-        PlayerAttributes* pitcherAttr = pitcher->getAttributes();
-        PlayerAttributes* batterAttr = batter->getAttributes();
-        if (!pitcherAttr || !batterAttr)
+        if (!fielding.pitcherHasAttributes || !batter.hasAttributes)
         {
-            std::cerr << "Missing attributes for pitcher or batter.\n";
-            gameOver = true;
+            BB_LOG_ERROR("[GameManager] Missing attributes for pitcher or batter.");
+            state.gameOver = true;
             return;
         }
 
@@ -134,34 +287,63 @@ namespace BBEngine
 
         StadiumContext stadium; // if you want to pass real data, do so
 
-        // 3. Call simulator
-        PitchOutcome outcome = simulator->simulatePitch(*pitcherAttr, *batterAttr, stadium, pitchCtx);
+        // The situation before the pitch, for the event log
+        const GameState before = state;
+        const int runsBefore = Record ? (isHomeBatting ? boxScore->getHomeTeamRuns() : boxScore->getAwayTeamRuns()) : 0;
 
-        // 4. If we get an in-play outcome, compute BattedBallOutcome
+        // 2. Call simulator
+        PitchOutcome outcome = simulator->simulatePitch(fielding.pitcherRatings, batter.ratings, stadium, pitchCtx);
+        BattedBallOutcome hitResult = BattedBallOutcome::OUT;
+
+        // 3. If we get an in-play outcome, compute BattedBallOutcome
         if (outcome == PitchOutcome::BATTED_BALL_IN_PLAY)
         {
-            BattedBallOutcome hitResult = simulator->computeBattedBallOutcome(*pitcherAttr, *batterAttr, stadium);
+            hitResult = simulator->computeBattedBallOutcome(fielding.pitcherRatings,
+                batter.ratings, stadium);
+        }
+
+        // 4. Play it out
+        applyPitch(outcome, hitResult);
+
+        if constexpr (Record)
+        {
+            const int runsAfter = isHomeBatting ? boxScore->getHomeTeamRuns() : boxScore->getAwayTeamRuns();
+            eventLog->append(before.inning, before.outs, before.bases, before.batterIndex[isHomeBatting ? 1 : 0],
+                isHomeBatting, outcome, hitResult, runsAfter - runsBefore);
+        }
+    }
+
+    // ----------------------------------------------------
+    // applyPitch: everything a pitch does once its outcome is known
+    // ----------------------------------------------------
+    void GameManager::applyPitch(PitchOutcome outcome, BattedBallOutcome hitResult)
+    {
+        const bool isHomeBatting = !state.topOfInning;
+        const ResolvedSide& batting = sides[isHomeBatting ? 1 : 0];
+        const ResolvedSide& fielding = sides[isHomeBatting ? 0 : 1];
+        std::uint8_t& batterIndex = state.batterIndex[isHomeBatting ? 1 : 0];
+        const LineupSlot& batter = batting.lineup[batterIndex];
 
+        if (outcome == PitchOutcome::BATTED_BALL_IN_PLAY)
+        {
             // We'll handle base runners and record in BoxScore
-            handleBattedBall(hitResult, isHomeBatting, batter, pitcher);
+            handleBattedBall(hitResult, isHomeBatting, batter.boxSlot, fielding.pitcher);
 
             // Once a ball is put in play, that at-bat ends. 
             // So increment the batter index
-            batterIndex = (batterIndex + 1) % lineup.size();
+            batterIndex = static_cast<std::uint8_t>((batterIndex + 1) % batting.lineupSize);
         }
         else if (outcome == PitchOutcome::BALL)
         {
             // We'll treat it as a walk => put batter on 1st, at-bat ends
-            // If runnerOnFirst, move them up, etc. Let's do minimal logic.
-            if (!runnerOnFirst) runnerOnFirst = true;
-            else if (!runnerOnSecond) runnerOnSecond = true;
-            else if (!runnerOnThird) runnerOnThird = true; // naive cascade
+            // Naive cascade: the runner goes to the lowest empty base (a no-op with the bases loaded)
+            state.bases |= static_cast<std::uint8_t>((state.bases + 1) & ~state.bases & 0x7);
 
             // record a walk in boxscore
-            boxScore->recordWalk(isHomeBatting, batter);
+            boxScore->recordWalkInSlot(isHomeBatting, batter.boxSlot);
 
             // at-bat ends, next batter
-            batterIndex = (batterIndex + 1) % lineup.size();
+            batterIndex = static_cast<std::uint8_t>((batterIndex + 1) % batting.lineupSize);
         }
         else if (outcome == PitchOutcome::FOUL)
         {
@@ -170,18 +352,61 @@ namespace BBEngine
             // We'll do no change to outs, no change to base runners, continue the same batter if we do multiple pitches.
             // but we said we'd skip real ball/strike counting, so let's do an immediate next pitch => no at-bat end
             // We'll do nothing but a small message
-            std::cout << "Foul ball (no at-bat end in this example). continuing pitch...\n";
+            BB_LOG_TRACE("[GameManager] Foul ball, same batter (inning " << static_cast<int>(state.inning) << ")");
         }
         else if (outcome == PitchOutcome::STRIKE_SWINGING
             || outcome == PitchOutcome::STRIKE_LOOKING)
         {
             // We'll call that a strikeout => out is incremented, at-bat ends
-            outs++;
-            boxScore->recordStrikeout(isHomeBatting, batter);
+            state.outs++;
+            boxScore->recordStrikeoutInSlot(isHomeBatting, batter.boxSlot);
 
             // next batter
-            batterIndex = (batterIndex + 1) % lineup.size();
+            batterIndex = static_cast<std::uint8_t>((batterIndex + 1) % batting.lineupSize);
+        }
+    }
+
+    // ----------------------------------------------------
+    // Replay
+    // ----------------------------------------------------
+    std::size_t GameManager::replayGame(const GameEventLog& log, std::size_t first, std::size_t last)
+    {
+        if (last > log.size())
+            last = log.size();
+
+        // The same half-inning order as playGame(), with the outcomes read from the log
+        std::size_t next = first;
+        while (!state.gameOver)
+        {
+            startHalfInning();
+            if (next >= last)
+                break; // parked at the start of a half-inning
+
+            while (state.outs < 3 && !state.gameOver && next < last)
+                replayPitch(log[next++]);
+            if (state.outs < 3 && !state.gameOver)
+                break; // stopped mid half-inning
+
+            finishHalfInning();
+        }
+        return next;
+    }
+
+    void GameManager::replayPitch(const PitchEvent& e)
+    {
+        const int side = state.topOfInning ? 0 : 1;
+        if (sides[side].lineupSize == 0)
+            throw std::runtime_error("[GameManager] Can't replay a pitch: no lineup for the batting team.");
+
+        // A log from a different game (or different lineups) drifts out of step quickly
+        if (e.inning != state.inning || e.isBottom() != !state.topOfInning || e.outs != state.outs
+            || e.bases != state.bases || e.batter != state.batterIndex[side])
+        {
+            throw std::runtime_error("[GameManager] Event log doesn't match the game being replayed.");
         }
+
+        applyPitch(e.getPitchOutcome(),
+            e.isInPlay() ? e.getBattedBallOutcome() : BattedBallOutcome::OUT);
     }
 
     // ----------------------------------------------------
@@ -192,21 +417,21 @@ namespace BBEngine
         // If we've completed 9 innings, or a walk-off scenario
         // For now let's do a naive approach: if inning >= 9, see if awayRuns != homeRuns
         // Actually let's do if we completed bottom of an inning and have a lead:
-        if (inning >= 9)
+        if (state.inning >= 9)
         {
             int homeRuns = boxScore->getHomeTeamRuns();
             int awayRuns = boxScore->getAwayTeamRuns();
 
             // If the game is not tied => gameOver
-            if (homeRuns != awayRuns && (!topOfInning)) // we've just finished bottom
+            if (homeRuns != awayRuns && (!state.topOfInning)) // we've just finished bottom
             {
-                gameOver = true;
+                state.gameOver = true;
             }
-            else if (homeRuns != awayRuns && (inning > 9))
+            else if (homeRuns != awayRuns && (state.inning > 9))
             {
                 // in extras, if we just finished topOfInning==false => means we finished bottom half
                 // or if the home team leads after top half => if away is behind => game over
-                gameOver = true;
+                state.gameOver = true;
             }
         }
     }
@@ -216,11 +441,15 @@ namespace BBEngine
     // ----------------------------------------------------
     void GameManager::startHalfInning()
     {
-        outs = 0;
-        // we keep base runners from previous half if we want a "clean" approach we do:
-        runnerOnFirst = false;
-        runnerOnSecond = false;
-        runnerOnThird = false;
+        // A new half-inning starts clean; a game restored mid-inning carries on as it was
+        if (state.outs >= 3)
+        {
+            state.outs = 0;
+            state.bases = 0;
+        }
+
+        // New runs go in this inning's column of the line score
+        boxScore->setCurrentInning(state.inning);
     }
 
     // ----------------------------------------------------
@@ -229,19 +458,18 @@ namespace BBEngine
     void GameManager::endHalfInning()
     {
         // Flip topOfInning if outs=3
-        topOfInning = !topOfInning;
+        state.topOfInning = !state.topOfInning;
 
-        if (topOfInning) // we just finished the bottom
+        if (state.topOfInning) // we just finished the bottom
         {
             // increment the inning
-            inning++;
+            state.inning++;
         }
     }
 
-    void GameManager::handleBattedBall(BattedBallOutcome outcome, bool isHome, Player* batter, Player* pitcher)
+    void GameManager::handleBattedBall(BattedBallOutcome outcome, bool isHome, int batterSlot, Player* /*pitcher*/)
     {
         int bases = 0; // number of bases the batter earns
-        int runsScored = 0;
 
         switch (outcome)
         {
@@ -258,9 +486,9 @@ namespace BBEngine
             bases = 4;
             break;
         case BattedBallOutcome::OUT:
-            outs++;
+            state.outs++;
             // record out in boxScore
-            // We can do: boxScore->recordAtBat(isHome, batter, 1,0,0,0,0,0,0,0,0); // an out is typically 1 AB
+            // We can do: boxScore->recordAtBatInSlot(isHome, batterSlot, 1,0,0,0,0,0,0,0,0); // an out is typically 1 AB
             // but let's skip details
             return;
         }
@@ -272,18 +500,17 @@ namespace BBEngine
         int isTriple = (bases == 3) ? 1 : 0;
         int isHR = (bases == 4) ? 1 : 0;
 
-        // We'll do a naive approach: if it's a HR, that automatically scores the batter + all runners
-        // if single/double/triple, we only do a naive approach
+        // Naive base running: every runner (and the batter) moves up exactly 'bases' bases.
+        // With the bases as a bit mask that's a shift: whatever shifts past third has scored.
+        const unsigned advanced = (static_cast<unsigned>(state.bases) << bases) | (1u << (bases - 1));
+        const unsigned scored = advanced >> 3;
+        const int runs = ((scored >> 0) & 1) + ((scored >> 1) & 1) + ((scored >> 2) & 1) + ((scored >> 3) & 1);
+        state.bases = static_cast<std::uint8_t>(advanced & 0x7);
+
         if (bases == 4)
         {
-            // Score all on base + batter
-            int runs = 1; // the batter
-            if (runnerOnFirst) runs++;
-            if (runnerOnSecond) runs++;
-            if (runnerOnThird) runs++;
-
-            // record runs in boxScore
-            boxScore->recordAtBat(isHome, batter,
+            // A HR scores all on base + batter
+            boxScore->recordAtBatInSlot(isHome, batterSlot,
                 1, // ab
                 hits, isDouble, isTriple, isHR,
                 runs - 1, // rbis => all except the batter's run if you do that logic
@@ -291,46 +518,17 @@ namespace BBEngine
                 0, // K
                 runs // runs scored by the batter
             );
-
-            // Clear the bases
-            runnerOnFirst = runnerOnSecond = runnerOnThird = false;
         }
         else
         {
-            // For single/double/triple, let's do a minimal approach:
-            // always move each runner up "bases" steps, scoring any who pass home
-            // move runner on third -> home => +1 run if bases >=1
-            int runCount = 0;
-            if (runnerOnThird && bases >= 1) { runCount++; runnerOnThird = false; }
-            // move runner on second-> third if bases>=1, ->home if bases>=2
-            if (runnerOnSecond)
-            {
-                runnerOnSecond = false;
-                if (bases >= 2) { runCount++; }
-                else { runnerOnThird = true; }
-            }
-            // runner on first-> second if bases>=1, -> third if bases>=2, ->home if bases>=3
-            if (runnerOnFirst)
-            {
-                runnerOnFirst = false;
-                if (bases >= 3) { runCount++; }
-                else if (bases == 2) { runnerOnThird = true; }
-                else { runnerOnSecond = true; }
-            }
-
-            // Batter ends up on base if bases<4
-            if (bases == 1) runnerOnFirst = true;
-            else if (bases == 2) runnerOnSecond = true;
-            else if (bases == 3) runnerOnThird = true;
-
             // record in boxScore
-            boxScore->recordAtBat(isHome, batter,
+            boxScore->recordAtBatInSlot(isHome, batterSlot,
                 1, // ab
                 hits, isDouble, isTriple, isHR,
-                runCount, // rbis
+                runs, // rbis
                 0, // walks
                 0, // K
-                runCount > 0 ? 1 : 0 // if the batter actually scored, e.g. triple with enough error
+                runs > 0 ? 1 : 0 // if the batter actually scored, e.g. triple with enough error
             );
         }
     }
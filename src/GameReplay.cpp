@@ -0,0 +1,96 @@
+#include "GameReplay.h"
+#include <stdexcept>
+
+namespace BBEngine
+{
+    GameReplay::GameReplay(Team* home, Team* away, const GameEventLog& eventLog, int checkpointInterval)
+        : homeTeam(home),
+        awayTeam(away),
+        log(&eventLog),
+        interval(checkpointInterval)
+    {
+        if (!homeTeam || !awayTeam)
+            throw std::invalid_argument("[GameReplay] Both teams are required.");
+        if (interval < 1)
+            throw std::invalid_argument("[GameReplay] Checkpoint interval must be at least 1.");
+
+        // Index the half-innings: they come in order, top 1st, bottom 1st, top 2nd, ...
+        for (std::size_t i = 0; i < log->size(); ++i)
+        {
+            const PitchEvent& e = (*log)[i];
+            const int h = 2 * (e.inning - 1) + (e.isBottom() ? 1 : 0);
+            if (h == static_cast<int>(halfStarts.size()))
+                halfStarts.push_back(i);
+            else if (h != static_cast<int>(halfStarts.size()) - 1)
+                throw std::invalid_argument("[GameReplay] Event log skips or repeats a half-inning.");
+        }
+
+        // One pass through the game, copying the state at every interval-th half-inning
+        BoxScore box(homeTeam->getName(), awayTeam->getName());
+        GameManager gm(homeTeam, awayTeam, &box, nullptr);
+        std::size_t next = 0;
+        for (std::size_t h = 0; h < halfStarts.size(); h += static_cast<std::size_t>(interval))
+        {
+            next = gm.replayGame(*log, next, halfStarts[h]);
+            checkpoints.push_back(Checkpoint{ halfStarts[h], gm.getState(), box });
+        }
+    }
+
+    int GameReplay::getHalfInningCount() const
+    {
+        return static_cast<int>(halfStarts.size());
+    }
+
+    std::size_t GameReplay::getCheckpointCount() const
+    {
+        return checkpoints.size();
+    }
+
+    int GameReplay::getCheckpointInterval() const
+    {
+        return interval;
+    }
+
+    std::size_t GameReplay::getFirstEvent(int inning, bool bottom) const
+    {
+        return halfStarts[halfIndex(inning, bottom)];
+    }
+
+    // -------------------------------------------------------
+    // Replay & seek
+    // -------------------------------------------------------
+    GameState GameReplay::replay(BoxScore& box) const
+    {
+        box.reset(homeTeam->getName(), awayTeam->getName());
+        GameManager gm(homeTeam, awayTeam, &box, nullptr);
+        gm.replayGame(*log);
+        return gm.getState();
+    }
+
+    GameState GameReplay::seek(int inning, bool bottom, BoxScore& box) const
+    {
+        const int h = halfIndex(inning, bottom);
+        const Checkpoint& checkpoint = checkpoints[h / interval];
+        box = checkpoint.box;
+        if (h % interval == 0)
+            return checkpoint.state;
+
+        // Between checkpoints: replay the half-innings in between
+        GameManager gm(homeTeam, awayTeam, &box, nullptr);
+        gm.setState(checkpoint.state);
+        gm.replayGame(*log, checkpoint.firstEvent, halfStarts[h]);
+        return gm.getState();
+    }
+
+    // -------------------------------------------------------
+    // Private Helpers
+    // -------------------------------------------------------
+    int GameReplay::halfIndex(int inning, bool bottom) const
+    {
+        const int h = 2 * (inning - 1) + (bottom ? 1 : 0);
+        if (inning < 1 || h >= getHalfInningCount())
+            throw std::out_of_range("[GameReplay] The game never reached that half-inning.");
+        return h;
+    }
+
+} // namespace BBEngine
@@ -1,5 +1,5 @@
 #include "InjuryManager.h"
-#include <iostream> // for debug prints
+#include "Log.h"
 #include <stdexcept> // for exceptions
 
 namespace BBEngine
@@ -16,7 +16,7 @@ namespace BBEngine
     {
         if (!player)
         {
-            std::cerr << "[InjuryManager] injurePlayer called with nullptr player.\n";
+            BB_LOG_WARNING("[InjuryManager] injurePlayer called with nullptr player.");
             return;
         }
         if (daysOut < 1) daysOut = 1; // minimal 1 day out, or your own logic
@@ -25,8 +25,8 @@ namespace BBEngine
         auto it = injuries.find(player);
         if (it != injuries.end())
         {
-            std::cerr << "[InjuryManager] Player " << player->getName()
-                << " is already injured. Updating info.\n";
+            BB_LOG_WARNING("[InjuryManager] Player " << player->getName()
+                << " is already injured. Updating info.");
             it->second.injuryType = injuryType;
             it->second.daysRemaining = daysOut;
             it->second.severityLevel = severityLevel;
@@ -43,9 +43,9 @@ namespace BBEngine
         // Also remove from active roster so the team can't use them
         removePlayerFromRoster(player);
 
-        std::cout << "[InjuryManager] Player " << player->getName()
+        BB_LOG_INFO("[InjuryManager] Player " << player->getName()
             << " is now injured ("
-            << injuryType << "), out for " << daysOut << " days.\n";
+            << injuryType << "), out for " << daysOut << " days.");
     }
 
     void InjuryManager::activatePlayer(Player* player)
@@ -53,14 +53,14 @@ namespace BBEngine
         auto it = injuries.find(player);
         if (it == injuries.end())
         {
-            std::cerr << "[InjuryManager] activatePlayer: " << player->getName()
-                << " is not in the injured list.\n";
+            BB_LOG_WARNING("[InjuryManager] activatePlayer: " << player->getName()
+                << " is not in the injured list.");
             return; // or ignore or throw
         }
         // remove from map
         injuries.erase(it);
-        std::cout << "[InjuryManager] Player " << player->getName()
-            << " is recovered and can be re-activated.\n";
+        BB_LOG_INFO("[InjuryManager] Player " << player->getName()
+            << " is recovered and can be re-activated.");
     }
 
     void InjuryManager::decrementInjuryTimers(int daysPassed)
@@ -86,8 +86,8 @@ namespace BBEngine
         for (auto* p : recoveredList)
         {
             injuries.erase(p);
-            std::cout << "[InjuryManager] Player " << p->getName()
-                << " has fully recovered.\n";
+            BB_LOG_INFO("[InjuryManager] Player " << p->getName()
+                << " has fully recovered.");
             // The team or manager can reinsert them in lineups if needed.
         }
     }
@@ -132,9 +132,9 @@ namespace BBEngine
         {
             // remove from the roster so they're not selectable
             theTeam->removePlayer(p);
-            std::cout << "[InjuryManager] Removed injured player "
+            BB_LOG_INFO("[InjuryManager] Removed injured player "
                 << p->getName() << " from team " << theTeam->getName()
-                << "'s roster.\n";
+                << "'s roster.");
         }
     }
 }
@@ -0,0 +1,96 @@
+#include "Leaderboard.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace BBEngine
+{
+    Leaderboard::Leaderboard(StatId statId, bool ascendingOrder)
+        : stat(statId),
+        ascending(ascendingOrder),
+        ordered(Order{ ascendingOrder })
+    {
+    }
+
+    StatId Leaderboard::getStat() const
+    {
+        return stat;
+    }
+
+    bool Leaderboard::isAscending() const
+    {
+        return ascending;
+    }
+
+    void Leaderboard::update(int playerID, double value)
+    {
+        if (playerID < 0)
+            throw std::invalid_argument("Leaderboard: negative player ID.");
+
+        if (static_cast<std::size_t>(playerID) >= values.size())
+        {
+            values.resize(playerID + 1, 0.0);
+            present.resize(playerID + 1, false);
+        }
+
+        if (present[playerID])
+        {
+            if (values[playerID] == value)
+                return; // nothing moved
+            ordered.erase(Entry{ values[playerID], playerID });
+        }
+
+        ordered.insert(Entry{ value, playerID });
+        values[playerID] = value;
+        present[playerID] = true;
+    }
+
+    void Leaderboard::remove(int playerID)
+    {
+        if (!contains(playerID))
+            return;
+
+        ordered.erase(Entry{ values[playerID], playerID });
+        present[playerID] = false;
+    }
+
+    bool Leaderboard::contains(int playerID) const
+    {
+        return playerID >= 0 && static_cast<std::size_t>(playerID) < present.size() && present[playerID];
+    }
+
+    double Leaderboard::getValue(int playerID) const
+    {
+        if (!contains(playerID))
+            throw std::out_of_range("Leaderboard: player is not on this board.");
+        return values[playerID];
+    }
+
+    std::size_t Leaderboard::size() const
+    {
+        return ordered.size();
+    }
+
+    std::vector<std::pair<int, double>> Leaderboard::top(int n) const
+    {
+        std::vector<std::pair<int, double>> result;
+        if (n <= 0)
+            return result;
+
+        result.reserve(std::min<std::size_t>(static_cast<std::size_t>(n), ordered.size()));
+        for (const Entry& e : ordered)
+        {
+            if (static_cast<int>(result.size()) >= n)
+                break;
+            result.push_back({ e.id, e.value });
+        }
+        return result;
+    }
+
+    bool Leaderboard::ranksAhead(double valueA, int idA, double valueB, int idB, bool ascending)
+    {
+        if (valueA != valueB)
+            return ascending ? (valueA < valueB) : (valueA > valueB);
+        return idA < idB;
+    }
+
+} // namespace BBEngine
@@ -1,5 +1,5 @@
 #include "League.h"
-#include <iostream>  // debug prints
+#include "Log.h"
 #include <cassert>   // for asserts
 #include <stdexcept> // if we throw exceptions
 
@@ -19,22 +19,9 @@ namespace BBEngine
 
     League::~League()
     {
-        // Clean up if you're dynamically allocating Seasons
-        // If we allocated currentSeason, we should delete it or move it to pastSeasons
-        if (currentSeason)
-        {
-            // optional: if you also push it to pastSeasons or destroy
-            // for demonstration, let's just do:
-            delete currentSeason;
-            currentSeason = nullptr;
-        }
-
-        // If we have a list of dynamic Seasons in pastSeasons, free them:
-        for (auto* s : pastSeasons)
-        {
-            delete s;
-        }
-        pastSeasons.clear();
+        // The current season (and its schedule & standings) live in seasonArena,
+        // whose destructor releases them. Past seasons are plain summaries.
+        currentSeason = nullptr;
 
         // If you allocated manager objects here, free them as well.
         // e.g. delete statsManager; ...
@@ -44,7 +31,7 @@ namespace BBEngine
     {
         if (!team)
         {
-            std::cerr << "[League] addTeam called with null team.\n";
+            BB_LOG_WARNING("[League] addTeam called with null team.");
             return;
         }
         // optionally check for duplicates
@@ -56,54 +43,55 @@ namespace BBEngine
         // If there's already a currentSeason, check if it's completed
         if (hasActiveSeason() && !currentSeason->isSeasonOver())
         {
-            std::cerr << "[League] There's already an active season that's not finished.\n";
+            BB_LOG_WARNING("[League] There's already an active season that's not finished.");
             return;
         }
 
-        // if we have a finished currentSeason, we can push it to pastSeasons
+        // if we have a finished currentSeason, we can archive it
         if (hasActiveSeason() && currentSeason->isSeasonOver())
         {
-            pastSeasons.push_back(currentSeason);
-            currentSeason = nullptr;
+            archiveCurrentSeason();
         }
 
         if (allTeams.empty())
         {
-            std::cerr << "[League] No teams found. Can't start new season.\n";
+            BB_LOG_WARNING("[League] No teams found. Can't start new season.");
             return;
         }
 
         // Create a new Season. We'll also create a new Schedule & Standings for it.
-        // Or we can do it outside. For demonstration:
-        Schedule* sched = new Schedule();
+        // All three come from the season arena, so archiving the season frees them in one go.
+        // So do their containers and the season's pooled BoxScores, through the arena's resource.
+        std::pmr::memory_resource* resource = seasonArena.getResource();
+        Schedule* sched = seasonArena.create<Schedule>(resource);
         sched->generateSchedule(allTeams);
 
-        Standings* stand = new Standings(allTeams);
+        Standings* stand = seasonArena.create<Standings>(allTeams, "", resource);
 
-        currentSeason = new Season(allTeams, sched, stand);
+        currentSeason = seasonArena.create<Season>(allTeams, sched, stand, resource);
         currentSeason->startSeason();
 
         // reset the league's currentDate if you want
         currentDate = 1;
 
-        std::cout << "[League] New season started with "
-            << allTeams.size() << " teams.\n";
+        BB_LOG_INFO("[League] New season started with "
+            << allTeams.size() << " teams.");
     }
 
     void League::advanceOneDay()
     {
         if (!hasActiveSeason())
         {
-            std::cerr << "[League] No active season to advance.\n";
+            BB_LOG_WARNING("[League] No active season to advance.");
             return;
         }
         if (currentSeason->isSeasonOver())
         {
-            std::cerr << "[League] Season is already over.\n";
+            BB_LOG_WARNING("[League] Season is already over.");
             return;
         }
 
-        std::cout << "[League] Advancing day " << currentDate << "\n";
+        BB_LOG_DEBUG("[League] Advancing day " << currentDate);
 
         // call season->simulateDay(currentDate)
         currentSeason->simulateDay(currentDate);
@@ -123,7 +111,7 @@ namespace BBEngine
     {
         if (!hasActiveSeason())
         {
-            std::cerr << "[League] finishSeason() but no active season.\n";
+            BB_LOG_WARNING("[League] finishSeason() but no active season.");
             return;
         }
         if (!currentSeason->isSeasonOver())
@@ -131,11 +119,10 @@ namespace BBEngine
             // forcibly finalize it anyway, or do a check first
             currentSeason->finalizeSeason();
         }
-        // Move it to pastSeasons
-        pastSeasons.push_back(currentSeason);
-        currentSeason = nullptr;
+        // Summarize it into pastSeasons and free the season's objects
+        archiveCurrentSeason();
 
-        std::cout << "[League] Season finished and archived. Ready for next.\n";
+        BB_LOG_INFO("[League] Season finished and archived. Ready for next.");
     }
 
     Season* League::getCurrentSeason() const
@@ -143,11 +130,16 @@ namespace BBEngine
         return currentSeason;
     }
 
-    const std::vector<Season*>& League::getPastSeasons() const
+    const std::vector<SeasonSummary>& League::getPastSeasons() const
     {
         return pastSeasons;
     }
 
+    const SeasonArena& League::getSeasonArena() const
+    {
+        return seasonArena;
+    }
+
     int League::getCurrentDate() const
     {
         return currentDate;
@@ -157,7 +149,7 @@ namespace BBEngine
     {
         if (d < 1)
         {
-            std::cerr << "[League] setCurrentDate: invalid day.\n";
+            BB_LOG_WARNING("[League] setCurrentDate: invalid day.");
             return;
         }
         currentDate = d;
@@ -167,4 +159,25 @@ namespace BBEngine
     {
         return (currentSeason != nullptr);
     }
+
+    void League::archiveCurrentSeason()
+    {
+        if (!currentSeason)
+            return;
+
+        SeasonSummary summary;
+        summary.seasonNumber = static_cast<int>(pastSeasons.size()) + 1;
+        if (Schedule* sched = currentSeason->getSchedule())
+            summary.gamesPlayed = sched->getCompletedCount();
+        if (Standings* stand = currentSeason->getStandings())
+        {
+            const auto& sorted = stand->getSnapshot();
+            summary.finalStandings.assign(sorted.begin(), sorted.end());
+        }
+        pastSeasons.push_back(summary);
+
+        // One bulk operation: Season, Standings, Schedule (and everything they own) go away
+        currentSeason = nullptr;
+        seasonArena.release();
+    }
 }
@@ -0,0 +1,181 @@
+#include "Log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace BBEngine
+{
+    namespace
+    {
+        std::atomic<LogSink*> currentSink{ nullptr };
+        std::atomic<LogLevel> minimumLevel{ LogLevel::Info };
+    }
+
+    const char* toString(LogLevel level)
+    {
+        switch (level)
+        {
+        case LogLevel::Trace:   return "Trace";
+        case LogLevel::Debug:   return "Debug";
+        case LogLevel::Info:    return "Info";
+        case LogLevel::Warning: return "Warning";
+        case LogLevel::Error:   return "Error";
+        default:                return "Off";
+        }
+    }
+
+    // -------------------------------------------------------
+    // Engine-wide settings
+    // -------------------------------------------------------
+    void Log::setSink(LogSink* sink)
+    {
+        currentSink.store(sink, std::memory_order_release);
+    }
+
+    LogSink* Log::getSink()
+    {
+        return currentSink.load(std::memory_order_acquire);
+    }
+
+    void Log::setLevel(LogLevel level)
+    {
+        minimumLevel.store(level, std::memory_order_relaxed);
+    }
+
+    LogLevel Log::getLevel()
+    {
+        return minimumLevel.load(std::memory_order_relaxed);
+    }
+
+    bool Log::isEnabled(LogLevel level)
+    {
+        return level != LogLevel::Off
+            && level >= minimumLevel.load(std::memory_order_relaxed)
+            && currentSink.load(std::memory_order_relaxed) != nullptr;
+    }
+
+    void Log::write(LogLevel level, const std::string& message)
+    {
+        LogSink* sink = getSink();
+        if (sink && level >= getLevel())
+            sink->write(level, message);
+    }
+
+    // -------------------------------------------------------
+    // StreamSink
+    // -------------------------------------------------------
+    StreamSink::StreamSink(std::ostream& stream)
+        : out(stream)
+    {
+    }
+
+    void StreamSink::write(LogLevel level, const std::string& message)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        out << "[" << toString(level) << "] " << message << "\n";
+    }
+
+    // -------------------------------------------------------
+    // RingBufferSink
+    // -------------------------------------------------------
+    RingBufferSink::RingBufferSink(std::size_t capacity)
+        : writePos(0),
+        readPos(0),
+        dropped(0)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        mask = size - 1;
+
+        // Slot i is free for the producer whose ticket is i
+        slots.reset(new Slot[size]);
+        for (std::size_t i = 0; i < size; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    void RingBufferSink::write(LogLevel level, const std::string& message)
+    {
+        std::size_t pos = writePos.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;)
+        {
+            slot = &slots[pos & mask];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0)
+            {
+                if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                // The reader hasn't freed this slot yet: full
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                pos = writePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        LogRecord& record = slot->record;
+        record.level = level;
+        record.length = static_cast<std::uint8_t>(std::min(message.size(), LogRecord::MaxLength));
+        std::memcpy(record.text, message.data(), record.length);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    bool RingBufferSink::pop(LogRecord& out)
+    {
+        std::size_t pos = readPos.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;)
+        {
+            slot = &slots[pos & mask];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (readPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false; // nothing written here yet: empty
+            }
+            else
+            {
+                pos = readPos.load(std::memory_order_relaxed);
+            }
+        }
+
+        out = slot->record;
+        // Free the slot for the producer one lap later
+        slot->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t RingBufferSink::drain(LogSink& target)
+    {
+        std::size_t count = 0;
+        LogRecord record;
+        while (pop(record))
+        {
+            target.write(record.level, record.getText());
+            ++count;
+        }
+        return count;
+    }
+
+    std::size_t RingBufferSink::getCapacity() const
+    {
+        return mask + 1;
+    }
+
+    std::uint64_t RingBufferSink::getDroppedCount() const
+    {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+} // namespace BBEngine
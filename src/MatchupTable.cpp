@@ -0,0 +1,13 @@
+#include "MatchupTable.h"
+
+namespace BBEngine
+{
+    const MatchupTable<DefaultMatchupFormula>& defaultMatchupTable()
+    {
+        // Function-local static: built once, thread-safe initialization, and it stays
+        // out of the binary image instead of being baked in at compile time.
+        static const MatchupTable<DefaultMatchupFormula> table;
+        return table;
+    }
+
+} // namespace BBEngine
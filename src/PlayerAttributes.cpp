@@ -1,4 +1,5 @@
 #include "PlayerAttributes.h"
+#include <stdexcept>
 
 namespace BBEngine
 {
@@ -6,25 +7,24 @@ namespace BBEngine
     // Constructor
     // -------------------------------------------------------
     PlayerAttributes::PlayerAttributes()
+        : table(nullptr),
+        playerID(-1)
     {
         // Initialize all attributes to a default, e.g., 50
-        contact = 50;
-        power = 50;
-        plateDiscipline = 50;
-
-        pitchVelocity = 50;
-        pitchControl = 50;
-        pitchMovement = 50;
-        stamina = 50;
-
-        reactionTime = 50;
-        armAccuracy = 50;
-        fieldingRange = 50;
+        for (auto& v : values)
+            v = 50;
+    }
 
-        speed = 50;
+    PlayerAttributes::PlayerAttributes(AttributeTable& viewTable, int id)
+        : table(&viewTable),
+        playerID(id)
+    {
+        if (id < 0 || static_cast<size_t>(id) >= viewTable.size())
+            throw std::out_of_range("PlayerAttributes: player ID not in the attribute table.");
 
-        durability = 50;
-        clutch = 50;
+        // Not read while bound, but keeps unbind()/copies well-defined
+        for (auto& v : values)
+            v = 50;
     }
 
     // -------------------------------------------------------
@@ -43,29 +43,29 @@ namespace BBEngine
     // -------------------------------------------------------
     int PlayerAttributes::getContact() const
     {
-        return contact;
+        return get(Attribute::Contact);
     }
     void PlayerAttributes::setContact(int value)
     {
-        contact = clampValue(value);
+        set(Attribute::Contact, value);
     }
 
     int PlayerAttributes::getPower() const
     {
-        return power;
+        return get(Attribute::Power);
     }
     void PlayerAttributes::setPower(int value)
     {
-        power = clampValue(value);
+        set(Attribute::Power, value);
     }
 
     int PlayerAttributes::getPlateDiscipline() const
     {
-        return plateDiscipline;
+        return get(Attribute::PlateDiscipline);
     }
     void PlayerAttributes::setPlateDiscipline(int value)
     {
-        plateDiscipline = clampValue(value);
+        set(Attribute::PlateDiscipline, value);
     }
 
     // -------------------------------------------------------
@@ -73,38 +73,38 @@ namespace BBEngine
     // -------------------------------------------------------
     int PlayerAttributes::getPitchVelocity() const
     {
-        return pitchVelocity;
+        return get(Attribute::PitchVelocity);
     }
     void PlayerAttributes::setPitchVelocity(int value)
     {
-        pitchVelocity = clampValue(value);
+        set(Attribute::PitchVelocity, value);
     }
 
     int PlayerAttributes::getPitchControl() const
     {
-        return pitchControl;
+        return get(Attribute::PitchControl);
     }
     void PlayerAttributes::setPitchControl(int value)
     {
-        pitchControl = clampValue(value);
+        set(Attribute::PitchControl, value);
     }
 
     int PlayerAttributes::getPitchMovement() const
     {
-        return pitchMovement;
+        return get(Attribute::PitchMovement);
     }
     void PlayerAttributes::setPitchMovement(int value)
     {
-        pitchMovement = clampValue(value);
+        set(Attribute::PitchMovement, value);
     }
 
     int PlayerAttributes::getStamina() const
     {
-        return stamina;
+        return get(Attribute::Stamina);
     }
     void PlayerAttributes::setStamina(int value)
     {
-        stamina = clampValue(value);
+        set(Attribute::Stamina, value);
     }
 
     // -------------------------------------------------------
@@ -112,29 +112,29 @@ namespace BBEngine
     // -------------------------------------------------------
     int PlayerAttributes::getReactionTime() const
     {
-        return reactionTime;
+        return get(Attribute::ReactionTime);
     }
     void PlayerAttributes::setReactionTime(int value)
     {
-        reactionTime = clampValue(value);
+        set(Attribute::ReactionTime, value);
     }
 
     int PlayerAttributes::getArmAccuracy() const
     {
-        return armAccuracy;
+        return get(Attribute::ArmAccuracy);
     }
     void PlayerAttributes::setArmAccuracy(int value)
     {
-        armAccuracy = clampValue(value);
+        set(Attribute::ArmAccuracy, value);
     }
 
     int PlayerAttributes::getFieldingRange() const
     {
-        return fieldingRange;
+        return get(Attribute::FieldingRange);
     }
     void PlayerAttributes::setFieldingRange(int value)
     {
-        fieldingRange = clampValue(value);
+        set(Attribute::FieldingRange, value);
     }
 
     // -------------------------------------------------------
@@ -142,11 +142,11 @@ namespace BBEngine
     // -------------------------------------------------------
     int PlayerAttributes::getSpeed() const
     {
-        return speed;
+        return get(Attribute::Speed);
     }
     void PlayerAttributes::setSpeed(int value)
     {
-        speed = clampValue(value);
+        set(Attribute::Speed, value);
     }
 
     // -------------------------------------------------------
@@ -154,20 +154,20 @@ namespace BBEngine
     // -------------------------------------------------------
     int PlayerAttributes::getDurability() const
     {
-        return durability;
+        return get(Attribute::Durability);
     }
     void PlayerAttributes::setDurability(int value)
     {
-        durability = clampValue(value);
+        set(Attribute::Durability, value);
     }
 
     int PlayerAttributes::getClutch() const
     {
-        return clutch;
+        return get(Attribute::Clutch);
     }
     void PlayerAttributes::setClutch(int value)
     {
-        clutch = clampValue(value);
+        set(Attribute::Clutch, value);
     }
 
     // -------------------------------------------------------
@@ -175,23 +175,11 @@ namespace BBEngine
     // -------------------------------------------------------
     void PlayerAttributes::clampAllAttributes()
     {
-        contact = clampValue(contact);
-        power = clampValue(power);
-        plateDiscipline = clampValue(plateDiscipline);
-
-        pitchVelocity = clampValue(pitchVelocity);
-        pitchControl = clampValue(pitchControl);
-        pitchMovement = clampValue(pitchMovement);
-        stamina = clampValue(stamina);
-
-        reactionTime = clampValue(reactionTime);
-        armAccuracy = clampValue(armAccuracy);
-        fieldingRange = clampValue(fieldingRange);
-
-        speed = clampValue(speed);
-
-        durability = clampValue(durability);
-        clutch = clampValue(clutch);
+        for (size_t a = 0; a < AttributeCount; ++a)
+        {
+            Attribute attribute = static_cast<Attribute>(a);
+            set(attribute, get(attribute));
+        }
     }
 
     double PlayerAttributes::averageHittingRating() const
@@ -199,14 +187,14 @@ namespace BBEngine
         // Example: combine contact, power, plateDiscipline
         // If plateDiscipline is optional, you can exclude or handle differently.
         // We assume all 3 are equally weighted.
-        double sum = static_cast<double>(contact + power + plateDiscipline);
+        double sum = static_cast<double>(getContact() + getPower() + getPlateDiscipline());
         return sum / 3.0;
     }
 
     double PlayerAttributes::averagePitchingRating() const
     {
         // Example: combine pitchVelocity, pitchControl, pitchMovement
-        double sum = static_cast<double>(pitchVelocity + pitchControl + pitchMovement);
+        double sum = static_cast<double>(getPitchVelocity() + getPitchControl() + getPitchMovement());
         return sum / 3.0;
     }
 
@@ -214,11 +202,64 @@ namespace BBEngine
     {
         // Example aging logic: reduce pitchVelocity slightly, maybe increase control, etc.
         // You can adapt this as needed or handle externally.
-        pitchVelocity = clampValue(pitchVelocity - 1);
-        pitchControl = clampValue(pitchControl + 1);
+        // (AttributeTable::ageOneYear() does the same for a whole table at once.)
+        setPitchVelocity(getPitchVelocity() - 1);
+        setPitchControl(getPitchControl() + 1);
 
         // You might also reduce durability, etc.
-        durability = clampValue(durability - 1);
+        setDurability(getDurability() - 1);
+    }
+
+    // -------------------------------------------------------
+    // Generic access & AttributeTable binding
+    // -------------------------------------------------------
+    int PlayerAttributes::get(Attribute attribute) const
+    {
+        if (table)
+            return table->get(attribute, playerID);
+        return values[static_cast<size_t>(attribute)];
+    }
+
+    void PlayerAttributes::set(Attribute attribute, int value)
+    {
+        if (table)
+            table->set(attribute, playerID, value); // clamps too
+        else
+            values[static_cast<size_t>(attribute)] = static_cast<std::uint8_t>(clampValue(value));
+    }
+
+    int PlayerAttributes::bindToTable(AttributeTable& newTable)
+    {
+        int id = newTable.addPlayer(*this);
+        table = &newTable;
+        playerID = id;
+        return id;
+    }
+
+    void PlayerAttributes::unbind()
+    {
+        if (!table)
+            return;
+
+        for (size_t a = 0; a < AttributeCount; ++a)
+            values[a] = static_cast<std::uint8_t>(table->get(static_cast<Attribute>(a), playerID));
+        table = nullptr;
+        playerID = -1;
+    }
+
+    bool PlayerAttributes::isBound() const
+    {
+        return table != nullptr;
+    }
+
+    AttributeTable* PlayerAttributes::getTable() const
+    {
+        return table;
+    }
+
+    int PlayerAttributes::getPlayerID() const
+    {
+        return playerID;
     }
 
 } // namespace BBEngine
@@ -9,7 +9,8 @@ namespace BBEngine
         : atBats(0), hits(0), doublesHit(0), triplesHit(0), homeRuns(0),
         walks(0), strikeouts(0), runs(0), rbis(0),
         inningsPitched(0.0), hitsAllowed(0), runsAllowed(0), earnedRuns(0),
-        walksAllowed(0), pitcherStrikeouts(0), wins(0), losses(0), saves(0)
+        walksAllowed(0), pitcherStrikeouts(0), wins(0), losses(0), saves(0),
+        version(0)
     {
         // All counters are zero at initialization.
     }
@@ -21,18 +22,21 @@ namespace BBEngine
     {
         if (count < 0) return; // Or throw an exception if you prefer
         atBats += count;
+        version++;
     }
 
     void PlayerStats::addHits(int count)
     {
         if (count < 0) return;
         hits += count;
+        version++;
     }
 
     void PlayerStats::addDoubles(int count)
     {
         if (count < 0) return;
         doublesHit += count;
+        version++;
         addHits(count); // Usually a double also counts as a hit
     }
 
@@ -40,6 +44,7 @@ namespace BBEngine
     {
         if (count < 0) return;
         triplesHit += count;
+        version++;
         addHits(count); // A triple is also a hit
     }
 
@@ -47,6 +52,7 @@ namespace BBEngine
     {
         if (count < 0) return;
         homeRuns += count;
+        version++;
         addHits(count); // A home run is also a hit
     }
 
@@ -54,24 +60,28 @@ namespace BBEngine
     {
         if (count < 0) return;
         walks += count;
+        version++;
     }
 
     void PlayerStats::addStrikeouts(int count)
     {
         if (count < 0) return;
         strikeouts += count;
+        version++;
     }
 
     void PlayerStats::addRuns(int count)
     {
         if (count < 0) return;
         runs += count;
+        version++;
     }
 
     void PlayerStats::addRBIs(int count)
     {
         if (count < 0) return;
         rbis += count;
+        version++;
     }
 
     // -------------------------------------------------------------
@@ -81,54 +91,63 @@ namespace BBEngine
     {
         if (innings < 0.0) return;
         inningsPitched += innings;
+        version++;
     }
 
     void PlayerStats::addHitsAllowed(int count)
     {
         if (count < 0) return;
         hitsAllowed += count;
+        version++;
     }
 
     void PlayerStats::addRunsAllowed(int count)
     {
         if (count < 0) return;
         runsAllowed += count;
+        version++;
     }
 
     void PlayerStats::addEarnedRuns(int count)
     {
         if (count < 0) return;
         earnedRuns += count;
+        version++;
     }
 
     void PlayerStats::addWalksAllowed(int count)
     {
         if (count < 0) return;
         walksAllowed += count;
+        version++;
     }
 
     void PlayerStats::addPitcherStrikeouts(int count)
     {
         if (count < 0) return;
         pitcherStrikeouts += count;
+        version++;
     }
 
     void PlayerStats::addWins(int count)
     {
         if (count < 0) return;
         wins += count;
+        version++;
     }
 
     void PlayerStats::addLosses(int count)
     {
         if (count < 0) return;
         losses += count;
+        version++;
     }
 
     void PlayerStats::addSaves(int count)
     {
         if (count < 0) return;
         saves += count;
+        version++;
     }
 
     // -------------------------------------------------------------
@@ -189,6 +208,8 @@ namespace BBEngine
     int    PlayerStats::getLosses()              const { return losses; }
     int    PlayerStats::getSaves()               const { return saves; }
 
+    unsigned long long PlayerStats::getVersion() const { return version; }
+
     // -------------------------------------------------------------
     // Utility: Reset for new season
     // -------------------------------------------------------------
@@ -215,6 +236,7 @@ namespace BBEngine
         wins = 0;
         losses = 0;
         saves = 0;
+        version++;
     }
 
 } // namespace BBEngine
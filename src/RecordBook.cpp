@@ -0,0 +1,210 @@
+#include "RecordBook.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace BBEngine
+{
+    RecordBook::RecordBook(int size)
+        : listSize(size)
+    {
+        if (listSize < 1)
+            throw std::invalid_argument("[RecordBook] List size must be at least 1.");
+    }
+
+    int RecordBook::getListSize() const
+    {
+        return listSize;
+    }
+
+    void RecordBook::setListener(const Listener& newListener)
+    {
+        listener = newListener;
+    }
+
+    std::vector<RecordEvent> RecordBook::drainEvents()
+    {
+        std::vector<RecordEvent> drained;
+        drained.swap(events);
+        return drained;
+    }
+
+    std::size_t RecordBook::getPendingEventCount() const
+    {
+        return events.size();
+    }
+
+    // -------------------------------------------------------
+    // Bulk update
+    // -------------------------------------------------------
+    void RecordBook::update(RecordScope scope, int when, const StatsTable& table,
+        const std::vector<int>& playerIDs, int teamGames)
+    {
+        if (scope == RecordScope::Count)
+            throw std::invalid_argument("[RecordBook] Not a record scope.");
+
+        for (const StatInfo& info : StatRegistry)
+        {
+            if (scope == RecordScope::SingleGame && info.qualifier != Qualifier::None)
+                continue;
+
+            info.column(table, values);
+
+            const double minimum = qualifyingMinimum(info.id, teamGames);
+            const bool filtered = minimum > 0.0;
+            if (filtered)
+            {
+                if (info.qualifier == Qualifier::PlateAppearances)
+                    table.computePlateAppearanceMask(minimum, qualified);
+                else
+                    table.computeInningsPitchedMask(minimum, qualified);
+            }
+
+            const std::vector<RecordEntry>& list = lists[static_cast<std::size_t>(scope)][static_cast<std::size_t>(info.id)];
+            auto eligible = [&](int id)
+            {
+                if (filtered && !qualified[id])
+                    return false;
+                return info.qualifier != Qualifier::None || values[id] > 0.0; // a zero isn't a record of anything
+            };
+
+            // Season-to-date and career entries follow the current value, worse or not, so their
+            // holders go first: a value that dropped must be in place before anyone else is
+            // compared against the end of the list
+            holders.clear();
+            if (scope != RecordScope::SingleGame)
+            {
+                held.resize(std::max(held.size(), table.size()));
+                for (const RecordEntry& e : list)
+                {
+                    if ((scope == RecordScope::Career || e.when == when) && e.playerID < static_cast<int>(table.size()))
+                    {
+                        held[e.playerID] = 1;
+                        holders.push_back(e.playerID);
+                    }
+                }
+                for (int id : playerIDs)
+                {
+                    if (!held[id])
+                        continue;
+                    if (eligible(id))
+                        offer(scope, info.id, RecordEntry{ id, when, values[id] });
+                    else
+                        withdraw(scope, info.id, id, when);
+                }
+            }
+
+            for (int id : playerIDs)
+            {
+                if (!holders.empty() && held[id])
+                    continue;
+                if (!eligible(id))
+                    continue;
+
+                const double v = values[id];
+
+                // Cheap reject: a full list only lets in values that beat its last entry
+                if (static_cast<int>(list.size()) >= listSize && !better(info.id, v, list.back().value))
+                    continue;
+
+                offer(scope, info.id, RecordEntry{ id, when, v });
+            }
+
+            for (int id : holders)
+                held[id] = 0;
+        }
+    }
+
+    // -------------------------------------------------------
+    // Access
+    // -------------------------------------------------------
+    const std::vector<RecordEntry>& RecordBook::getRecords(RecordScope scope, StatId stat) const
+    {
+        return lists[static_cast<std::size_t>(scope)][static_cast<std::size_t>(stat)];
+    }
+
+    RecordEntry RecordBook::getRecord(RecordScope scope, StatId stat) const
+    {
+        const std::vector<RecordEntry>& list = getRecords(scope, stat);
+        return list.empty() ? RecordEntry() : list.front();
+    }
+
+    void RecordBook::clear()
+    {
+        for (auto& scopeLists : lists)
+            for (auto& list : scopeLists)
+                list.clear();
+        events.clear();
+    }
+
+    // -------------------------------------------------------
+    // Private Helpers
+    // -------------------------------------------------------
+    void RecordBook::offer(RecordScope scope, StatId stat, const RecordEntry& entry)
+    {
+        std::vector<RecordEntry>& list = lists[static_cast<std::size_t>(scope)][static_cast<std::size_t>(stat)];
+        const RecordEntry previous = list.empty() ? RecordEntry() : list.front();
+
+        // One entry per player per game/season, one per career
+        auto sameKey = [&](const RecordEntry& e)
+        {
+            return e.playerID == entry.playerID && (scope == RecordScope::Career || e.when == entry.when);
+        };
+        auto existing = std::find_if(list.begin(), list.end(), sameKey);
+        if (existing != list.end())
+        {
+            // A game is over once it's recorded; a season or a career can still go down
+            if (scope == RecordScope::SingleGame && !better(stat, entry.value, existing->value))
+                return;
+            list.erase(existing);
+        }
+
+        // Stable: an equal value never displaces the one that got there first
+        auto pos = std::find_if(list.begin(), list.end(),
+            [&](const RecordEntry& e) { return better(stat, entry.value, e.value); });
+        list.insert(pos, entry);
+        if (static_cast<int>(list.size()) > listSize)
+            list.pop_back();
+
+        announce(scope, stat, previous);
+    }
+
+    void RecordBook::withdraw(RecordScope scope, StatId stat, int playerID, int when)
+    {
+        std::vector<RecordEntry>& list = lists[static_cast<std::size_t>(scope)][static_cast<std::size_t>(stat)];
+        const RecordEntry previous = list.front();
+
+        list.erase(std::find_if(list.begin(), list.end(), [&](const RecordEntry& e)
+        {
+            return e.playerID == playerID && (scope == RecordScope::Career || e.when == when);
+        }));
+
+        announce(scope, stat, previous);
+    }
+
+    void RecordBook::announce(RecordScope scope, StatId stat, const RecordEntry& previous)
+    {
+        const std::vector<RecordEntry>& list = lists[static_cast<std::size_t>(scope)][static_cast<std::size_t>(stat)];
+        if (list.empty())
+            return;
+
+        // A career's 'when' is just the last update, so re-dating it isn't news
+        const RecordEntry& top = list.front();
+        bool changed = previous.playerID < 0
+            || top.playerID != previous.playerID
+            || (scope != RecordScope::Career && top.when != previous.when)
+            || top.value != previous.value;
+        if (changed)
+        {
+            RecordEvent event{ stat, scope, top, previous };
+            events.push_back(event);
+            if (listener)
+                listener(event);
+        }
+    }
+
+    bool RecordBook::better(StatId stat, double a, double b)
+    {
+        return getStatInfo(stat).direction == SortDirection::LowerIsBetter ? a < b : a > b;
+    }
+
+} // namespace BBEngine
@@ -1,10 +1,16 @@
 #include "Schedule.h"
-#include <algorithm>  // for std::find_if
+#include <algorithm>  // for std::lower_bound
 
 namespace BBEngine
 {
-    Schedule::Schedule()
-        : nextGameID(1000)  // Start from 1000 if you like
+    Schedule::Schedule(std::pmr::memory_resource* resource)
+        : games(resource),
+        indexByID(resource),
+        gamesByDate(resource),
+        completedCount(0),
+        remainingByDate(resource),
+        firstGameID(1000),  // Start from 1000 if you like
+        nextGameID(1000)
     {
     }
 
@@ -30,7 +36,7 @@ namespace BBEngine
                 g.homeScore = 0;
                 g.awayScore = 0;
                 g.boxScore = nullptr;
-                games.push_back(g);
+                addGame(g);
 
                 // Create an away game for i vs j => means j is home, i is away => on date=2
                 GameEntry g2;
@@ -43,27 +49,52 @@ namespace BBEngine
                 g2.homeScore = 0;
                 g2.awayScore = 0;
                 g2.boxScore = nullptr;
-                games.push_back(g2);
+                addGame(g2);
             }
         }
     }
 
-    const std::vector<GameEntry>& Schedule::getAllGames() const
+    const std::pmr::vector<GameEntry>& Schedule::getAllGames() const
     {
         return games;
     }
 
-    std::vector<GameEntry> Schedule::getGamesOn(int date) const
+    GameRange Schedule::getGamesOn(int date) const
     {
-        std::vector<GameEntry> result;
-        for (const auto& gm : games)
-        {
-            if (gm.date == date)
-            {
-                result.push_back(gm);
-            }
-        }
-        return result;
+        auto it = gamesByDate.find(date);
+        if (it == gamesByDate.end() || it->second.empty())
+            return GameRange();
+
+        const std::pmr::vector<int>& indices = it->second;
+        return GameRange(games.data(), indices.data(), indices.data() + indices.size());
+    }
+
+    const GameEntry* Schedule::findGame(int gameID) const
+    {
+        int idx = findGameIndexByID(gameID);
+        return (idx < 0) ? nullptr : &games[idx];
+    }
+
+    int Schedule::getCompletedCount() const
+    {
+        return completedCount;
+    }
+
+    int Schedule::getRemainingCount() const
+    {
+        return static_cast<int>(games.size()) - completedCount;
+    }
+
+    bool Schedule::allGamesCompleted() const
+    {
+        return completedCount == static_cast<int>(games.size());
+    }
+
+    int Schedule::getNextUnplayedDate(int fromDate) const
+    {
+        // Dates whose games are all done are erased from the map, so the first hit is the answer
+        auto it = remainingByDate.lower_bound(fromDate);
+        return (it == remainingByDate.end()) ? -1 : it->first;
     }
 
     void Schedule::recordGameResult(int gameID, int awayScore, int homeScore)
@@ -76,7 +107,7 @@ namespace BBEngine
         }
         games[idx].awayScore = awayScore;
         games[idx].homeScore = homeScore;
-        games[idx].completed = true;
+        markCompleted(idx);
 
         // In a real sim, you'd call something like: updateStandings(awayTeam, homeTeam, awayScore, homeScore);
         // or notify the Season that the game is done.
@@ -86,7 +117,7 @@ namespace BBEngine
     {
         int idx = findGameIndexByID(gameID);
         if (idx < 0) return;
-        games[idx].completed = true;
+        markCompleted(idx);
         games[idx].boxScore = box;
         if (box)
         {
@@ -98,10 +129,46 @@ namespace BBEngine
         }
     }
 
+    void Schedule::clearBoxScore(int gameID)
+    {
+        int idx = findGameIndexByID(gameID);
+        if (idx < 0) return;
+        games[idx].boxScore = nullptr;
+    }
+
     void Schedule::postponeGame(int gameID, int newDate)
     {
         int idx = findGameIndexByID(gameID);
         if (idx < 0) return;
+        int oldDate = games[idx].date;
+
+        // A postponed game is unplayed again, and its remaining count moves with it
+        if (games[idx].completed)
+        {
+            completedCount--;
+        }
+        else
+        {
+            auto rem = remainingByDate.find(oldDate);
+            if (rem != remainingByDate.end() && --rem->second == 0)
+                remainingByDate.erase(rem);
+        }
+        remainingByDate[newDate]++;
+
+        if (oldDate != newDate)
+        {
+            // Move the game from its old date bucket to the new one, keeping both sorted
+            std::pmr::vector<int>& oldBucket = gamesByDate[oldDate];
+            auto pos = std::lower_bound(oldBucket.begin(), oldBucket.end(), idx);
+            if (pos != oldBucket.end() && *pos == idx)
+                oldBucket.erase(pos);
+            if (oldBucket.empty())
+                gamesByDate.erase(oldDate);
+
+            std::pmr::vector<int>& newBucket = gamesByDate[newDate];
+            newBucket.insert(std::lower_bound(newBucket.begin(), newBucket.end(), idx), idx);
+        }
+
         // Mark old date as changed
         games[idx].date = newDate;
         games[idx].completed = false; // if it was completed, maybe it's weird, but let's do it
@@ -109,12 +176,44 @@ namespace BBEngine
 
     int Schedule::findGameIndexByID(int gameID) const
     {
-        for (size_t i = 0; i < games.size(); ++i)
-        {
-            if (games[i].gameID == gameID)
-                return static_cast<int>(i);
-        }
-        return -1;
+        if (gameID < firstGameID)
+            return -1;
+        std::size_t slot = static_cast<std::size_t>(gameID - firstGameID);
+        if (slot >= indexByID.size())
+            return -1;
+        return indexByID[slot];
+    }
+
+    void Schedule::addGame(const GameEntry& game)
+    {
+        int idx = static_cast<int>(games.size());
+        games.push_back(game);
+
+        std::size_t slot = static_cast<std::size_t>(game.gameID - firstGameID);
+        if (slot >= indexByID.size())
+            indexByID.resize(slot + 1, -1);
+        indexByID[slot] = idx;
+
+        // Games are appended in ID order, so pushing to the back keeps the bucket sorted
+        gamesByDate[game.date].push_back(idx);
+
+        if (game.completed)
+            completedCount++;
+        else
+            remainingByDate[game.date]++;
+    }
+
+    void Schedule::markCompleted(int idx)
+    {
+        GameEntry& g = games[idx];
+        if (g.completed)
+            return;
+        g.completed = true;
+        completedCount++;
+
+        auto rem = remainingByDate.find(g.date);
+        if (rem != remainingByDate.end() && --rem->second == 0)
+            remainingByDate.erase(rem);
     }
 
 } // namespace BBEngine
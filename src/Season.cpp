@@ -1,18 +1,30 @@
 #include "Season.h"
-#include <iostream>  // for debug prints or logs
+#include "GameManager.h"
+#include "Log.h"
 #include <cassert>
+#include <random>    // std::random_device for the default seed
 
 namespace BBEngine
 {
     Season::Season(const std::vector<Team*>& participatingTeams,
         Schedule* sched,
-        Standings* stand)
-        : teams(participatingTeams),
+        Standings* stand,
+        std::pmr::memory_resource* resource)
+        : teams(participatingTeams.begin(), participatingTeams.end(), resource),
         schedule(sched),
         standings(stand),
         seasonStarted(false),
-        seasonComplete(false)
+        seasonComplete(false),
+        seed(0),
+        workerThreads(0),
+        simulators(resource),
+        boxPool(resource),
+        boxPoolGameIDs(resource),
+        dayGames(resource)
     {
+        std::random_device rd;
+        seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+
         // Possibly validate that sched and stand are not null, 
         // that teams is not empty, etc.
     }
@@ -21,7 +33,7 @@ namespace BBEngine
     {
         if (seasonStarted)
         {
-            std::cerr << "[Season] Already started.\n";
+            BB_LOG_WARNING("[Season] Already started.");
             return;
         }
         seasonStarted = true;
@@ -34,37 +46,47 @@ namespace BBEngine
     {
         if (!schedule)
         {
-            std::cerr << "[Season] No schedule assigned!\n";
+            BB_LOG_WARNING("[Season] No schedule assigned!");
             return;
         }
         if (!standings)
         {
-            std::cerr << "[Season] No standings assigned!\n";
+            BB_LOG_WARNING("[Season] No standings assigned!");
             return;
         }
 
-        // 1. Retrieve the day's games
-        auto todaysGames = schedule->getGamesOn(date);
-
-        // 2. For each game, we "simulate" it. In a real system, we'd create a GameManager, run it, get final boxscore.
-        // For demonstration, we'll do a mock approach: we just produce random or hard-coded final scores, 
-        // then call recordGameResult.
-        int i = 0;
-        for (auto& g : todaysGames)
+        // 1. Retrieve the day's unplayed games. The schedule hands them out in gameID order,
+        //    which keeps the merge below deterministic.
+        GameRange todaysGames = schedule->getGamesOn(date);
+        dayGames.clear();
+        for (const auto& g : todaysGames)
         {
             if (!g.completed)
-            {
-                // We'll produce some mock final score
-                // or we might do real simulation with a GameManager.
-                int awayScore = (rand() % 5); // random 0..4
-                int homeScore = (rand() % 5);
-                // We'll increment i in the scores just to differentiate.
-                awayScore += i;
-                homeScore += (i / 2);
-                i++;
-
-                recordGameResult(g.gameID, awayScore, homeScore);
-            }
+                dayGames.push_back(&g);
+        }
+
+        // 2. Play every game as its own task. Task i only writes boxPool[i].
+        acquireBoxScores(dayGames.size());
+        ensureWorkers();
+        pool->parallelFor(dayGames.size(), [&](std::size_t i, int worker) {
+            playGame(*dayGames[i], boxPool[i], simulators[worker]);
+            });
+
+        // 3. Merge into schedule & standings on this thread, in gameID order
+        for (std::size_t i = 0; i < dayGames.size(); ++i)
+        {
+            const GameEntry& g = *dayGames[i];
+            BoxScore* box = &boxPool[i];
+
+            schedule->setGameCompleted(g.gameID, box);
+            boxPoolGameIDs[i] = g.gameID;
+            updateStandingsForGame(g.gameID, box->getAwayTeamRuns(), box->getHomeTeamRuns());
+
+            // Both starters have pitched; move each rotation along
+            if (g.homeTeam && g.homeTeam->getRotation())
+                g.homeTeam->getRotation()->advanceRotation();
+            if (g.awayTeam && g.awayTeam->getRotation())
+                g.awayTeam->getRotation()->advanceRotation();
         }
 
         // after we do that, we can check if the season is over
@@ -82,50 +104,109 @@ namespace BBEngine
             schedule->recordGameResult(gameID, awayScore, homeScore);
         }
         // 2. Update standings
-        if (standings)
+        updateStandingsForGame(gameID, awayScore, homeScore);
+    }
+
+    void Season::updateStandingsForGame(int gameID, int awayScore, int homeScore)
+    {
+        if (!standings || !schedule)
+            return;
+
+        // If awayScore > homeScore => away wins
+        // else home wins or tie => let's say tie goes to home if you don't allow ties.
+        // We find the schedule entry again to see who was away/home
+        const GameEntry* game = schedule->findGame(gameID);
+        Team* awayTeam = game ? game->awayTeam : nullptr;
+        Team* homeTeam = game ? game->homeTeam : nullptr;
+        if (!awayTeam || !homeTeam)
         {
-            // If awayScore > homeScore => away wins
-            // else home wins or tie => let's say tie goes to home if you don't allow ties.
-            Team* awayTeam = nullptr;
-            Team* homeTeam = nullptr;
+            BB_LOG_WARNING("[Season] recordGameResult: Could not find teams for gameID=" << gameID);
+            return;
+        }
 
-            // We can find the schedule entry again to see who was away/home
-            // or if schedule->recordGameResult also updates a reference
-            // For demonstration, let's do this:
-            if (!schedule)
-                return;
+        if (awayScore > homeScore)
+        {
+            standings->recordGameResult(awayTeam, homeTeam);  // away wins, home loses
+        }
+        else
+        {
+            standings->recordGameResult(homeTeam, awayTeam);  // home wins, away loses
+        }
 
-            auto allG = schedule->getAllGames();
-            for (const auto& g : allG)
-            {
-                if (g.gameID == gameID)
-                {
-                    awayTeam = g.awayTeam;
-                    homeTeam = g.homeTeam;
-                    break;
-                }
-            }
-            if (!awayTeam || !homeTeam)
-            {
-                std::cerr << "[Season] recordGameResult: Could not find teams for gameID=" << gameID << "\n";
-                return;
-            }
+        // No standings->updateStandings() here: the standings keep their order as results come in.
+    }
 
-            if (awayScore > homeScore)
-            {
-                standings->recordGameResult(awayTeam, homeTeam);  // away wins, home loses
-            }
-            else
-            {
-                standings->recordGameResult(homeTeam, awayTeam);  // home wins, away loses
-            }
+    void Season::setSeed(std::uint64_t newSeed)
+    {
+        seed = newSeed;
+        for (auto& sim : simulators)
+        {
+            sim.setSeed(seed);
+        }
+    }
 
-            // optionally standings->updateStandings();
-            // we might do it once a day, not after every single game.
-            standings->updateStandings();
+    std::uint64_t Season::getSeed() const
+    {
+        return seed;
+    }
+
+    void Season::setWorkerThreads(int threads)
+    {
+        workerThreads = (threads < 0 ? 0 : threads);
+    }
+
+    int Season::getWorkerThreads() const
+    {
+        return workerThreads;
+    }
+
+    void Season::ensureWorkers()
+    {
+        int wanted = workerThreads;
+        if (wanted <= 0)
+        {
+            wanted = static_cast<int>(std::thread::hardware_concurrency());
+            if (wanted <= 0) wanted = 1;
+        }
+
+        if (!pool || pool->getThreadCount() != wanted)
+        {
+            pool.reset(new ThreadPool(wanted));
+            simulators.assign(pool->getThreadCount(), Simulator(seed));
         }
     }
 
+    void Season::acquireBoxScores(std::size_t count)
+    {
+        // Yesterday's box scores are about to be overwritten; detach them from their games first
+        for (int gameID : boxPoolGameIDs)
+        {
+            if (gameID >= 0 && schedule)
+                schedule->clearBoxScore(gameID);
+        }
+
+        while (boxPool.size() < count)
+        {
+            boxPool.emplace_back("", "", boxPool.get_allocator().resource());
+        }
+        boxPoolGameIDs.assign(boxPool.size(), -1);
+    }
+
+    void Season::playGame(const GameEntry& game, BoxScore& box, Simulator& sim) const
+    {
+        box.reset(game.homeTeam ? game.homeTeam->getName() : "",
+            game.awayTeam ? game.awayTeam->getName() : "");
+
+        if (!game.homeTeam || !game.awayTeam)
+            return; // nothing to play; the box stays 0-0
+
+        // Every game draws from its own stream of the season seed, whichever thread runs it.
+        sim.beginGame(game.gameID);
+
+        GameManager manager(game.homeTeam, game.awayTeam, &box, &sim);
+        manager.runGame();
+    }
+
     bool Season::isSeasonOver() const
     {
         return seasonComplete;
@@ -157,17 +238,19 @@ namespace BBEngine
 
     std::vector<Team*> Season::getTeams() const
     {
-        return teams;
+        return std::vector<Team*>(teams.begin(), teams.end());
+    }
+
+    int Season::getNextGameDate(int fromDate) const
+    {
+        if (!schedule) return -1;
+        return schedule->getNextUnplayedDate(fromDate);
     }
 
     bool Season::allGamesCompleted() const
     {
+        // The schedule keeps a running count, so this is O(1)
         if (!schedule) return true;
-        auto allG = schedule->getAllGames();
-        for (const auto& g : allG)
-        {
-            if (!g.completed) return false;
-        }
-        return true;
+        return schedule->allGamesCompleted();
     }
 }
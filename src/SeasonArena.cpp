@@ -0,0 +1,92 @@
+#include "SeasonArena.h"
+
+namespace BBEngine
+{
+    SeasonArena::SeasonArena(std::size_t initialBlockSize)
+        : initialSize(initialBlockSize > 0 ? initialBlockSize : 1024),
+        initialBlock(new std::byte[initialSize]),
+        resource(initialBlock.get(), initialSize),
+        containerResource(this),
+        destructors(nullptr),
+        bytesAllocated(0),
+        objectCount(0)
+    {
+    }
+
+    SeasonArena::~SeasonArena()
+    {
+        release();
+    }
+
+    void* SeasonArena::allocate(std::size_t bytes, std::size_t alignment)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        bytesAllocated += bytes;
+        return resource.allocate(bytes, alignment);
+    }
+
+    void SeasonArena::release()
+    {
+        // Newest first, so an object can still use anything created before it while being destroyed
+        DestructorEntry* entry = destructors;
+        while (entry)
+        {
+            DestructorEntry* next = entry->next;
+            entry->destroy(entry->object);
+            entry = next;
+        }
+        destructors = nullptr;
+        objectCount = 0;
+        bytesAllocated = 0;
+
+        // One bulk free: drops every extra block and rewinds to the start of the initial one
+        resource.release();
+    }
+
+    std::pmr::memory_resource* SeasonArena::getResource()
+    {
+        return &containerResource;
+    }
+
+    std::size_t SeasonArena::getBytesAllocated() const
+    {
+        return bytesAllocated;
+    }
+
+    std::size_t SeasonArena::getObjectCount() const
+    {
+        return objectCount;
+    }
+
+    std::size_t SeasonArena::getInitialBlockSize() const
+    {
+        return initialSize;
+    }
+
+    void SeasonArena::registerDestructor(void* object, void (*destroy)(void*))
+    {
+        // The bookkeeping lives in the arena too
+        void* memory = allocate(sizeof(DestructorEntry), alignof(DestructorEntry));
+        destructors = ::new (memory) DestructorEntry{ destroy, object, destructors };
+        objectCount++;
+    }
+
+    // -------------------------------------------------
+    // Resource
+    // -------------------------------------------------
+    void* SeasonArena::Resource::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        return arena->allocate(bytes, alignment);
+    }
+
+    void SeasonArena::Resource::do_deallocate(void*, std::size_t, std::size_t)
+    {
+        // Nothing to do: it all goes back at release()
+    }
+
+    bool SeasonArena::Resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+} // namespace BBEngine
@@ -0,0 +1,340 @@
+#include "SeasonProjection.h"
+#include "Season.h"
+#include "ThreadPool.h"
+#include "CounterRng.h"
+#include <algorithm>      // std::sort, std::min, std::max
+#include <unordered_map>
+#include <random>         // std::random_device for the default seed
+
+namespace BBEngine
+{
+    // ----------------------------------------------------
+    // Per-worker tally
+    // ----------------------------------------------------
+    struct SeasonProjection::Tally
+    {
+        // Totals over every replica this worker ran (flattened per-team tables)
+        std::vector<std::uint64_t> winSum;     // [team]
+        std::vector<std::uint64_t> playoff;    // [team]
+        std::vector<std::uint64_t> division;   // [team]
+        std::vector<std::uint64_t> seed;       // [team * playoffSpots + k]
+        std::vector<std::uint64_t> finish;     // [team * teamCount + place]
+        std::vector<std::uint64_t> winHist;    // [team * (maxWins + 1) + wins]
+
+        // Scratch for one replica: the copy-on-write part of the standings
+        std::vector<int> winDelta;
+        std::vector<int> lossDelta;
+        std::vector<int> order;
+        std::vector<std::uint32_t> tiebreak;
+        std::vector<char> divisionTaken;
+        std::vector<char> seeded;
+
+        Tally(std::size_t teamCount, int divisionCount, int playoffSpots, int maxWins)
+            : winSum(teamCount, 0), playoff(teamCount, 0), division(teamCount, 0),
+            seed(teamCount * playoffSpots, 0), finish(teamCount * teamCount, 0),
+            winHist(teamCount * (maxWins + 1), 0),
+            winDelta(teamCount, 0), lossDelta(teamCount, 0), order(teamCount, 0),
+            tiebreak(teamCount, 0), divisionTaken(divisionCount, 0), seeded(teamCount, 0)
+        {
+        }
+    };
+
+    // ----------------------------------------------------
+    // Construction / settings
+    // ----------------------------------------------------
+    SeasonProjection::SeasonProjection(const Schedule& schedule, const Standings& standings)
+        : seed(0),
+        workerThreads(0),
+        playoffSpots(6)
+    {
+        std::random_device rd;
+        seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+
+        fork(schedule, standings);
+        model = defaultGameModel();
+    }
+
+    SeasonProjection::SeasonProjection(const Season& season)
+        : seed(season.getSeed()),
+        workerThreads(season.getWorkerThreads()),
+        playoffSpots(6)
+    {
+        if (season.getSchedule() && season.getStandings())
+        {
+            fork(*season.getSchedule(), *season.getStandings());
+        }
+        else
+        {
+            state = std::make_shared<SeasonState>();
+        }
+        model = defaultGameModel();
+    }
+
+    void SeasonProjection::setGameModel(const GameModel& newModel)
+    {
+        model = newModel ? newModel : defaultGameModel();
+    }
+
+    void SeasonProjection::setSeed(std::uint64_t newSeed)
+    {
+        seed = newSeed;
+    }
+
+    std::uint64_t SeasonProjection::getSeed() const
+    {
+        return seed;
+    }
+
+    void SeasonProjection::setWorkerThreads(int threads)
+    {
+        workerThreads = (threads < 0 ? 0 : threads);
+    }
+
+    int SeasonProjection::getWorkerThreads() const
+    {
+        return workerThreads;
+    }
+
+    void SeasonProjection::setPlayoffSpots(int spots)
+    {
+        playoffSpots = (spots < 0 ? 0 : spots);
+    }
+
+    int SeasonProjection::getPlayoffSpots() const
+    {
+        return playoffSpots;
+    }
+
+    int SeasonProjection::getRemainingGameCount() const
+    {
+        return static_cast<int>(state->games.size());
+    }
+
+    SeasonProjection::GameModel SeasonProjection::defaultGameModel() const
+    {
+        // Capture the shared snapshot, not 'this', so the model survives copies of the projection
+        std::shared_ptr<const SeasonState> snap = state;
+        std::unordered_map<const Team*, int> index;
+        for (std::size_t i = 0; i < snap->teams.size(); ++i)
+            index[snap->teams[i]] = static_cast<int>(i);
+
+        return [snap, index](const Team* home, const Team* away) {
+            auto pct = [&](const Team* t) {
+                auto it = index.find(t);
+                if (it == index.end()) return 0.5;
+                int w = snap->wins[it->second];
+                int l = snap->losses[it->second];
+                return (w + 10.0) / (w + l + 20.0);
+            };
+            const double ph = pct(home);
+            const double pa = pct(away);
+            const double log5 = (ph - ph * pa) / (ph + pa - 2.0 * ph * pa);
+            return std::min(1.0, std::max(0.0, log5 + 0.04));
+            };
+    }
+
+    // ----------------------------------------------------
+    // Running
+    // ----------------------------------------------------
+    std::vector<TeamProjection> SeasonProjection::run(int replicas) const
+    {
+        const SeasonState& st = *state;
+        const std::size_t teamCount = st.teams.size();
+        const int spots = static_cast<int>(std::min<std::size_t>(playoffSpots, teamCount));
+
+        std::vector<TeamProjection> result(teamCount);
+        for (std::size_t t = 0; t < teamCount; ++t)
+        {
+            result[t].team = st.teams[t];
+            result[t].division = st.divisions[t];
+        }
+        if (replicas <= 0 || teamCount == 0)
+            return result;
+
+        // The model is a function of the matchup only, so evaluate it once per game up front
+        std::vector<double> homeWinProb(st.games.size());
+        for (std::size_t g = 0; g < st.games.size(); ++g)
+        {
+            homeWinProb[g] = model(st.teams[st.games[g].home], st.teams[st.games[g].away]);
+        }
+
+        ThreadPool pool(workerThreads);
+        const int workers = pool.getThreadCount();
+        std::vector<Tally> tallies;
+        tallies.reserve(workers);
+        for (int w = 0; w < workers; ++w)
+            tallies.emplace_back(teamCount, st.divisionCount, spots, st.maxWins);
+
+        // Hand out replicas in chunks: enough to balance the load, few enough to keep overhead down
+        const std::size_t chunkCount = std::min<std::size_t>(replicas, static_cast<std::size_t>(workers) * 16);
+        pool.parallelFor(chunkCount, [&](std::size_t chunk, int worker) {
+            const std::uint32_t first = static_cast<std::uint32_t>(chunk * replicas / chunkCount);
+            const std::uint32_t last = static_cast<std::uint32_t>((chunk + 1) * replicas / chunkCount);
+            for (std::uint32_t r = first; r < last; ++r)
+                runReplica(r, homeWinProb, tallies[worker]);
+            });
+
+        // Add the workers' counters together (integer sums, so the order doesn't matter)
+        Tally& total = tallies[0];
+        for (int w = 1; w < workers; ++w)
+        {
+            auto add = [](std::vector<std::uint64_t>& into, const std::vector<std::uint64_t>& from) {
+                for (std::size_t i = 0; i < into.size(); ++i) into[i] += from[i];
+                };
+            add(total.winSum, tallies[w].winSum);
+            add(total.playoff, tallies[w].playoff);
+            add(total.division, tallies[w].division);
+            add(total.seed, tallies[w].seed);
+            add(total.finish, tallies[w].finish);
+            add(total.winHist, tallies[w].winHist);
+        }
+
+        const double n = static_cast<double>(replicas);
+        const std::size_t histWidth = static_cast<std::size_t>(st.maxWins) + 1;
+        for (std::size_t t = 0; t < teamCount; ++t)
+        {
+            TeamProjection& proj = result[t];
+            int teamGames = st.wins[t] + st.losses[t];
+            for (const auto& g : st.games)
+            {
+                if (g.home == static_cast<int>(t) || g.away == static_cast<int>(t)) teamGames++;
+            }
+
+            proj.meanWins = total.winSum[t] / n;
+            proj.meanLosses = teamGames - proj.meanWins;
+            proj.playoffProbability = total.playoff[t] / n;
+            proj.divisionProbability = total.division[t] / n;
+
+            proj.seedProbability.resize(spots);
+            for (int k = 0; k < spots; ++k)
+                proj.seedProbability[k] = total.seed[t * spots + k] / n;
+
+            proj.finishProbability.resize(teamCount);
+            for (std::size_t k = 0; k < teamCount; ++k)
+                proj.finishProbability[k] = total.finish[t * teamCount + k] / n;
+
+            proj.winDistribution.resize(histWidth);
+            for (std::size_t w = 0; w < histWidth; ++w)
+                proj.winDistribution[w] = total.winHist[t * histWidth + w] / n;
+        }
+        return result;
+    }
+
+    // ----------------------------------------------------
+    // Private helpers
+    // ----------------------------------------------------
+    void SeasonProjection::fork(const Schedule& schedule, const Standings& standings)
+    {
+        auto snap = std::make_shared<SeasonState>();
+
+        std::unordered_map<const Team*, int> index;
+        std::unordered_map<std::string, int> divisionIndex;
+        for (const auto& rec : standings.getSnapshot())
+        {
+            index[rec.team] = static_cast<int>(snap->teams.size());
+            snap->teams.push_back(rec.team);
+            snap->divisions.push_back(rec.division);
+            snap->wins.push_back(rec.wins);
+            snap->losses.push_back(rec.losses);
+
+            auto div = divisionIndex.emplace(rec.division, static_cast<int>(divisionIndex.size())).first;
+            snap->divisionOf.push_back(div->second);
+        }
+        snap->divisionCount = static_cast<int>(divisionIndex.size());
+
+        std::vector<int> maxWins = snap->wins;
+        for (const auto& g : schedule.getAllGames())
+        {
+            if (g.completed) continue;
+            auto home = index.find(g.homeTeam);
+            auto away = index.find(g.awayTeam);
+            if (home == index.end() || away == index.end())
+                continue; // not a team in these standings
+
+            snap->games.push_back(ProjectedGame{ home->second, away->second });
+            maxWins[home->second]++;
+            maxWins[away->second]++;
+        }
+        for (int w : maxWins)
+            snap->maxWins = std::max(snap->maxWins, w);
+
+        state = snap;
+    }
+
+    void SeasonProjection::runReplica(std::uint32_t replica, const std::vector<double>& homeWinProb,
+        Tally& tally) const
+    {
+        const SeasonState& st = *state;
+        const int teamCount = static_cast<int>(st.teams.size());
+        const int spots = static_cast<int>(tally.seed.size()) / teamCount;
+        const std::size_t histWidth = static_cast<std::size_t>(st.maxWins) + 1;
+
+        CounterRng rng(seed, replica);
+        rng.setDomain(RngDomain);
+
+        // 1. Play out the remaining games on top of the shared snapshot
+        std::fill(tally.winDelta.begin(), tally.winDelta.end(), 0);
+        std::fill(tally.lossDelta.begin(), tally.lossDelta.end(), 0);
+        for (std::size_t g = 0; g < st.games.size(); ++g)
+        {
+            const bool homeWins = CounterRng::toUnit(rng()) < homeWinProb[g];
+            const int winner = homeWins ? st.games[g].home : st.games[g].away;
+            const int loser = homeWins ? st.games[g].away : st.games[g].home;
+            tally.winDelta[winner]++;
+            tally.lossDelta[loser]++;
+        }
+
+        // 2. Final order: W-L difference, with exact ties broken by coin flip
+        for (int t = 0; t < teamCount; ++t)
+        {
+            tally.order[t] = t;
+            tally.tiebreak[t] = rng();
+        }
+        auto diff = [&](int t) {
+            return (st.wins[t] + tally.winDelta[t]) - (st.losses[t] + tally.lossDelta[t]);
+            };
+        std::sort(tally.order.begin(), tally.order.end(), [&](int a, int b) {
+            int da = diff(a), db = diff(b);
+            if (da != db) return da > db;
+            return tally.tiebreak[a] < tally.tiebreak[b];
+            });
+
+        // 3. Tally: finishing place, win total, division winners, playoff seeds
+        std::fill(tally.divisionTaken.begin(), tally.divisionTaken.end(), 0);
+        std::fill(tally.seeded.begin(), tally.seeded.end(), 0);
+        int nextSeed = 0;
+        for (int place = 0; place < teamCount; ++place)
+        {
+            const int t = tally.order[place];
+            const int finalWins = st.wins[t] + tally.winDelta[t];
+            tally.finish[static_cast<std::size_t>(t) * teamCount + place]++;
+            tally.winSum[t] += finalWins;
+            tally.winHist[t * histWidth + finalWins]++;
+
+            if (!tally.divisionTaken[st.divisionOf[t]])
+            {
+                tally.divisionTaken[st.divisionOf[t]] = 1;
+                tally.division[t]++;
+
+                // Division winners get the top seeds, in order of record
+                if (nextSeed < spots)
+                {
+                    tally.seeded[t] = 1;
+                    tally.seed[static_cast<std::size_t>(t) * spots + nextSeed++]++;
+                    tally.playoff[t]++;
+                }
+            }
+        }
+
+        // Wild cards: the best teams that didn't win a division
+        for (int place = 0; place < teamCount && nextSeed < spots; ++place)
+        {
+            const int t = tally.order[place];
+            if (tally.seeded[t]) continue;
+            tally.seeded[t] = 1;
+            tally.seed[static_cast<std::size_t>(t) * spots + nextSeed++]++;
+            tally.playoff[t]++;
+        }
+    }
+
+} // namespace BBEngine
@@ -1,27 +1,94 @@
 #include "Simulator.h"
 #include <cmath>      // for distance calculations if needed
 #include <algorithm>  // std::clamp if you want
-#include <iostream>   // debug prints if wanted
+#include <random>     // std::random_device for the default seed
 
 namespace BBEngine
 {
     Simulator::Simulator()
+        : nextPitchIndex(0),
+        matchupTable(defaultMatchupTable().view())
     {
         // seed with some default (non-deterministic) seed
         std::random_device rd;
-        rng.seed(rd());
+        std::uint64_t seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+        rng.setSeed(seed);
     }
 
-    void Simulator::setRandomEngine(std::mt19937 newEngine)
+    Simulator::Simulator(std::uint64_t seed)
+        : rng(seed),
+        nextPitchIndex(0),
+        matchupTable(defaultMatchupTable().view())
+    {
+    }
+
+    // ----------------------------------------------------
+    // Random engine control
+    // ----------------------------------------------------
+    void Simulator::setRandomEngine(const CounterRng& newEngine)
     {
         rng = newEngine;
     }
 
+    CounterRng& Simulator::getRandomEngine()
+    {
+        return rng;
+    }
+
+    const CounterRng& Simulator::getRandomEngine() const
+    {
+        return rng;
+    }
+
+    void Simulator::setSeed(std::uint64_t seed)
+    {
+        rng.setSeed(seed);
+    }
+
+    std::uint64_t Simulator::getSeed() const
+    {
+        return rng.getSeed();
+    }
+
+    void Simulator::beginGame(int gameID)
+    {
+        rng.setStream(static_cast<std::uint32_t>(gameID));
+        nextPitchIndex = 0;
+    }
+
+    std::uint32_t Simulator::getPitchIndex() const
+    {
+        return nextPitchIndex;
+    }
+
+    void Simulator::setPitchIndex(std::uint32_t index)
+    {
+        nextPitchIndex = index;
+    }
+
+    void Simulator::setMatchupTable(const MatchupTableView& table)
+    {
+        matchupTable = table;
+    }
+
     PitchOutcome Simulator::simulatePitch(const PlayerAttributes& pitcherAttr,
         const PlayerAttributes& batterAttr,
+        const StadiumContext& stadium,
+        const PitchContext& pitchCtx)
+    {
+        return simulatePitch(PitcherRatings::from(pitcherAttr), BatterRatings::from(batterAttr),
+            stadium, pitchCtx);
+    }
+
+    PitchOutcome Simulator::simulatePitch(const PitcherRatings& pitcher,
+        const BatterRatings& batter,
         const StadiumContext& /*stadium*/,
         const PitchContext& pitchCtx)
     {
+        // Every pitch gets its own slice of the random stream, so a pitch's rolls don't depend
+        // on how many numbers earlier pitches happened to use.
+        rng.seekPitch(nextPitchIndex++);
+
         // 1. Check if it's an intentional walk scenario
         if (pitchCtx.intentionalWalk)
         {
@@ -30,11 +97,10 @@ namespace BBEngine
         }
 
         // 2. Probability approach for strike vs. ball
-        double strikeProb = getStrikeProbability(pitcherAttr, batterAttr, pitchCtx);
+        double strikeProb = getStrikeProbability(pitcher, batter, pitchCtx);
 
         // Generate a random number 0..1
-        std::uniform_real_distribution<double> dist(0.0, 1.0);
-        double roll = dist(rng);
+        double roll = CounterRng::toUnit(rng());
 
         if (roll > strikeProb)
         {
@@ -45,13 +111,13 @@ namespace BBEngine
         {
             // It's in the strike zone. Next let's see if the batter swings or not, or if its a foul or contact.
             // We'll do a simplistic approach: contactProb = getContactProbability(...).
-            double contactProb = getContactProbability(pitcherAttr, batterAttr);
+            double contactProb = getContactProbability(pitcher, batter);
 
-            double roll2 = dist(rng);
+            double roll2 = CounterRng::toUnit(rng());
             if (roll2 > contactProb)
             {
                 // Batter misses or doesn't swing => let's say half the time it's a strike looking, half it's swinging
-                double roll3 = dist(rng);
+                double roll3 = CounterRng::toUnit(rng());
                 if (roll3 < 0.5)
                     return PitchOutcome::STRIKE_LOOKING;
                 else
@@ -61,7 +127,7 @@ namespace BBEngine
             {
                 // Batter makes contact. Could be foul or in-play
                 // Let's say 30% of contact is a foul, 70% is in-play (arbitrary)
-                double roll4 = dist(rng);
+                double roll4 = CounterRng::toUnit(rng());
                 if (roll4 < 0.3)
                     return PitchOutcome::FOUL;
                 else
@@ -70,12 +136,102 @@ namespace BBEngine
         }
     }
 
+    void Simulator::simulatePitches(const PitchMatchup* matchups,
+        const PitchContext* contexts,
+        std::size_t count,
+        const StadiumContext& /*stadium*/,
+        PitchOutcome* outcomes)
+    {
+        // We work through the batch in fixed-size chunks so the scratch arrays
+        // can live on the stack instead of being allocated per call.
+        constexpr std::size_t ChunkSize = 256;
+        double strikeProb[ChunkSize];
+        double contactProb[ChunkSize];
+        double roll1[ChunkSize];
+        double roll2[ChunkSize];
+        double roll3[ChunkSize];
+
+        const std::uint32_t firstPitchIndex = nextPitchIndex;
+        const std::uint32_t stream = rng.getStream();
+        const std::uint32_t key0 = rng.getKey()[0];
+        const std::uint32_t key1 = rng.getKey()[1];
+
+        for (std::size_t start = 0; start < count; start += ChunkSize)
+        {
+            const std::size_t n = std::min(ChunkSize, count - start);
+            const PitchMatchup* chunkMatchups = matchups + start;
+            const PitchContext* chunkContexts = contexts + start;
+            PitchOutcome* chunkOutcomes = outcomes + start;
+
+            // 1. Probability pass: no randomness, no data-dependent control flow.
+            //    An intentional walk gets a strike probability of -1, which always resolves to a ball.
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const PitcherRatings pitcher = PitcherRatings::from(*chunkMatchups[i].pitcher);
+                const BatterRatings batter = BatterRatings::from(*chunkMatchups[i].batter);
+                double sp = getStrikeProbability(pitcher, batter, chunkContexts[i]);
+                strikeProb[i] = chunkContexts[i].intentionalWalk ? -1.0 : sp;
+                contactProb[i] = getContactProbability(pitcher, batter);
+            }
+
+            // 2. Random pass: pitch i's rolls are the first three words of its own counter block,
+            //    which is exactly what simulatePitch() would read for that pitch index.
+            const std::uint32_t chunkFirstIndex = firstPitchIndex + static_cast<std::uint32_t>(start);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const CounterRng::Block block = CounterRng::generate(0,
+                    chunkFirstIndex + static_cast<std::uint32_t>(i), stream, 0, key0, key1);
+                roll1[i] = CounterRng::toUnit(block[0]);
+                roll2[i] = CounterRng::toUnit(block[1]);
+                roll3[i] = CounterRng::toUnit(block[2]);
+            }
+
+            // 3. Resolve pass: branch-free selects mirroring the decision tree in simulatePitch().
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const bool isBall = roll1[i] > strikeProb[i];
+                const bool isContact = roll2[i] <= contactProb[i];
+
+                const PitchOutcome missed = (roll3[i] < 0.5) ? PitchOutcome::STRIKE_LOOKING
+                    : PitchOutcome::STRIKE_SWINGING;
+                const PitchOutcome contacted = (roll3[i] < 0.3) ? PitchOutcome::FOUL
+                    : PitchOutcome::BATTED_BALL_IN_PLAY;
+                const PitchOutcome inZone = isContact ? contacted : missed;
+
+                chunkOutcomes[i] = isBall ? PitchOutcome::BALL : inZone;
+            }
+        }
+
+        if (count == 0)
+            return;
+
+        // Leave the engine exactly where the equivalent simulatePitch() calls would have:
+        // positioned inside the last pitch's stream, past the words that pitch consumed.
+        nextPitchIndex = firstPitchIndex + static_cast<std::uint32_t>(count);
+        rng.seekPitch(nextPitchIndex - 1);
+        int consumed = 3;
+        if (contexts[count - 1].intentionalWalk)
+            consumed = 0;
+        else if (outcomes[count - 1] == PitchOutcome::BALL)
+            consumed = 1;
+        for (int i = 0; i < consumed; ++i)
+            rng();
+    }
+
     BattedBallOutcome Simulator::computeBattedBallOutcome(const PlayerAttributes& pitcherAttr,
         const PlayerAttributes& batterAttr,
         const StadiumContext& stadium)
+    {
+        return computeBattedBallOutcome(PitcherRatings::from(pitcherAttr), BatterRatings::from(batterAttr),
+            stadium);
+    }
+
+    BattedBallOutcome Simulator::computeBattedBallOutcome(const PitcherRatings& pitcher,
+        const BatterRatings& batter,
+        const StadiumContext& stadium)
     {
         // For demonstration, let's guess a "distance" for the hit
-        double distance = estimateHitDistance(pitcherAttr, batterAttr);
+        double distance = estimateHitDistance(pitcher, batter);
 
         // Compare with stadium fence
         double minFence = std::min({ stadium.fenceDistanceLeft,
@@ -112,57 +268,35 @@ namespace BBEngine
         // For brevity, we skip that here.
     }
 
-    double Simulator::getStrikeProbability(const PlayerAttributes& pitcherAttr,
-        const PlayerAttributes& batterAttr,
-        const PitchContext& pitchCtx)
+    double Simulator::getStrikeProbability(const PitcherRatings& pitcher,
+        const BatterRatings& batter,
+        const PitchContext& pitchCtx) const
     {
-        // A naive formula:
-        // strikeProb = (pitcherControl + 1/2 pitcherVelocity) / sum_of_possible + maybe minus batterDisc
-        // if pitchOut => reduce strike probability
-        double ctrl = static_cast<double>(pitcherAttr.getPitchControl());
-        double velo = static_cast<double>(pitcherAttr.getPitchVelocity());
-        double disc = static_cast<double>(batterAttr.getPlateDiscipline());
-
-        double base = (ctrl + 0.5 * velo) / 150.0; // 150 is an arbitrary scaling factor
-        // if the batter is disciplined, reduce strike prob slightly
-        base -= (disc / 300.0);
-
-        if (pitchCtx.pitchOut)
-        {
-            // reduce chance of strike further
-            base -= 0.2;
-        }
-
-        // clamp between 0..1
-        if (base < 0.0) base = 0.0;
-        if (base > 1.0) base = 1.0;
-
-        return base;
+        // The formula itself lives in DefaultMatchupFormula (or a custom one); here we just index the table.
+        return matchupTable.strikeProbability(pitcher.control,
+            pitcher.velocity,
+            batter.discipline,
+            pitchCtx.pitchOut);
     }
 
-    double Simulator::getContactProbability(const PlayerAttributes& /*pitcherAttr*/,
-        const PlayerAttributes& batterAttr)
+    double Simulator::getContactProbability(const PitcherRatings& /*pitcher*/,
+        const BatterRatings& batter) const
     {
-        // A naive formula: contact prob is based on batter's contact rating
-        double c = static_cast<double>(batterAttr.getContact());
-        double base = c / 100.0; // e.g., if contact=75 => 0.75 base
-        if (base < 0.0) base = 0.0;
-        if (base > 1.0) base = 1.0;
-        return base;
+        // Contact prob is based on the batter's contact rating, e.g. contact=75 => 0.75
+        return matchupTable.contactProbability(batter.contact);
     }
 
-    double Simulator::estimateHitDistance(const PlayerAttributes& pitcherAttr,
-        const PlayerAttributes& batterAttr)
+    double Simulator::estimateHitDistance(const PitcherRatings& pitcher,
+        const BatterRatings& batter)
     {
         // For demonstration, let's do:
         // distance = (batterPower + random(0..20)) - pitcherVelocityFactor
         // The logic is arbitrary, just for an example
-        double power = static_cast<double>(batterAttr.getPower());
-        double velo = static_cast<double>(pitcherAttr.getPitchVelocity());
+        double power = static_cast<double>(batter.power);
+        double velo = static_cast<double>(pitcher.velocity);
 
-        // random offset
-        std::uniform_real_distribution<double> dist(0.0, 20.0);
-        double randomBoost = dist(rng);
+        // random offset 0..20, drawn from the current pitch's stream
+        double randomBoost = 20.0 * CounterRng::toUnit(rng());
 
         // If velocity is huge, maybe it helps or hinders... let's do a mild factor
         double distance = power + randomBoost - (velo * 0.1);
@@ -1,38 +1,68 @@
 #include "Standings.h"
-#include <algorithm>  // for std::sort
-#include <iostream>   // for debug prints if needed
+#include <algorithm>  // for std::stable_sort
+#include <numeric>    // for std::iota
 #include <cassert>
 
 namespace BBEngine
 {
-    Standings::Standings(const std::vector<Team*>& allTeams, const std::string& defaultDivision)
+    Standings::Standings(const std::vector<Team*>& allTeams, const std::string& defaultDivision,
+        std::pmr::memory_resource* resource)
+        : records(resource),
+        recordIndex(resource),
+        ranking(resource),
+        nameRank(resource),
+        version(0),
+        snapshotVersion(~0ULL),
+        snapshot(resource)
     {
         for (auto* t : allTeams)
         {
+            if (recordIndex.count(t))
+                continue; // listed twice; one record is enough
+
             // each record starts at 0-0
+            recordIndex[t] = static_cast<int>(records.size());
             TeamRecord rec(t, defaultDivision);
             records.push_back(rec);
         }
-        // optionally call updateStandings() if you want initial sorting
-        updateStandings();
+
+        // Rank the names once up front; the tiebreak only ever compares these
+        std::vector<int> byName(records.size());
+        std::iota(byName.begin(), byName.end(), 0);
+        std::stable_sort(byName.begin(), byName.end(), [this](int a, int b) {
+            return records[a].team->getName() < records[b].team->getName();
+            });
+        nameRank.assign(records.size(), 0);
+        for (std::size_t i = 0; i < byName.size(); ++i)
+            nameRank[byName[i]] = static_cast<int>(i);
+
+        // Everybody is 0-0, so the initial order is just the name order
+        for (int rec : byName)
+            ranking.insert(ranking.end(), keyOf(rec));
     }
 
     void Standings::recordWin(Team* team)
     {
-        TeamRecord* rec = findRecord(team);
-        if (!rec)
+        int rec = findRecord(team);
+        if (rec < 0)
         {
             // could throw or log. We'll just ignore for now
             return;
         }
-        rec->wins++;
+        const RankKey before = keyOf(rec);
+        records[rec].wins++;
+        reposition(rec, before);
+        version++;
     }
 
     void Standings::recordLoss(Team* team)
     {
-        TeamRecord* rec = findRecord(team);
-        if (!rec) return;
-        rec->losses++;
+        int rec = findRecord(team);
+        if (rec < 0) return;
+        const RankKey before = keyOf(rec);
+        records[rec].losses++;
+        reposition(rec, before);
+        version++;
     }
 
     void Standings::recordGameResult(Team* winner, Team* loser)
@@ -43,102 +73,102 @@ namespace BBEngine
 
     void Standings::updateStandings()
     {
-        // If you want to separate by division, you could group them, sort each, then merge or store them separately.
-        // We'll do a single list sort for demonstration.
+        // The order is maintained incrementally; all that's left is games-behind,
+        // which getSnapshot() fills in if anything changed.
+        getSnapshot();
+    }
 
-        // Step 1: sort the records by best W-L
-        std::sort(records.begin(), records.end(), teamRecordCompare);
+    std::vector<TeamRecord> Standings::getOverallStandings() const
+    {
+        const auto& sorted = getSnapshot();
+        return std::vector<TeamRecord>(sorted.begin(), sorted.end());
+    }
 
-        // Step 2: compute games behind the top team
-        computeGamesBehind();
+    const std::pmr::vector<TeamRecord>& Standings::getSnapshot() const
+    {
+        if (snapshotVersion != version)
+        {
+            snapshot.clear();
+            snapshot.reserve(ranking.size());
+            for (const RankKey& key : ranking)
+                snapshot.push_back(records[key.rec]);
+            computeGamesBehind(snapshot);
+            snapshotVersion = version;
+        }
+        return snapshot;
     }
 
-    std::vector<TeamRecord> Standings::getOverallStandings() const
+    unsigned long long Standings::getVersion() const
     {
-        return records; // note: they're not guaranteed sorted if you haven't called updateStandings() recently
+        return version;
     }
 
     std::vector<TeamRecord> Standings::getStandingsForDivision(const std::string& division) const
     {
-        // filter by division
+        // filter by division; the snapshot is already sorted, so the sub-list is too
         std::vector<TeamRecord> result;
-        for (const auto& rec : records)
+        for (const auto& rec : getSnapshot())
         {
             if (rec.division == division)
             {
                 result.push_back(rec);
             }
         }
-        // The caller might want to do a final sort, or we do it here. We'll do a local sort:
-        std::sort(result.begin(), result.end(), teamRecordCompare);
-
         return result;
     }
 
     int Standings::getWins(Team* team) const
     {
-        for (const auto& rec : records)
-        {
-            if (rec.team == team)
-                return rec.wins;
-        }
-        return -1; // or throw
+        int rec = findRecord(team);
+        return (rec < 0) ? -1 : records[rec].wins; // or throw
     }
 
     int Standings::getLosses(Team* team) const
     {
-        for (const auto& rec : records)
-        {
-            if (rec.team == team)
-                return rec.losses;
-        }
-        return -1; // or throw
+        int rec = findRecord(team);
+        return (rec < 0) ? -1 : records[rec].losses; // or throw
     }
 
-    TeamRecord* Standings::findRecord(Team* team)
+    // ----------------------------------------------------
+    // Private helpers
+    // ----------------------------------------------------
+    int Standings::findRecord(Team* team) const
     {
-        for (auto& rec : records)
-        {
-            if (rec.team == team)
-                return &rec;
-        }
-        return nullptr;
+        auto it = recordIndex.find(team);
+        return (it == recordIndex.end()) ? -1 : it->second;
+    }
+
+    Standings::RankKey Standings::keyOf(int rec) const
+    {
+        return RankKey{ records[rec].wins - records[rec].losses, nameRank[rec], rec };
+    }
+
+    void Standings::reposition(int rec, const RankKey& before)
+    {
+        // Re-key the record's own node: no allocation, O(log n) both ways
+        auto node = ranking.extract(before);
+        assert(!node.empty());
+        node.value() = keyOf(rec);
+        ranking.insert(std::move(node));
     }
 
-    void Standings::computeGamesBehind()
+    void Standings::computeGamesBehind(std::pmr::vector<TeamRecord>& sorted) const
     {
-        if (records.empty()) return;
+        if (sorted.empty()) return;
 
-        // We assume records is sorted by best record first
-        // The top team is records[0]. We'll compare each other team to them.
-        int leaderWins = records[0].wins;
-        int leaderLosses = records[0].losses;
+        // We assume the list is sorted by best record first
+        // The top team is sorted[0]. We'll compare each other team to them.
+        int leaderWins = sorted[0].wins;
+        int leaderLosses = sorted[0].losses;
 
-        for (size_t i = 0; i < records.size(); ++i)
+        for (size_t i = 0; i < sorted.size(); ++i)
         {
-            int w = records[i].wins;
-            int l = records[i].losses;
+            int w = sorted[i].wins;
+            int l = sorted[i].losses;
             // formula = ((leaderWins - w) + (l - leaderLosses)) / 2
             double gb = static_cast<double>((leaderWins - w) + (l - leaderLosses)) / 2.0;
             if (gb < 0.0) gb = 0.0; // if they are leading or tied
-            records[i].gamesBehind = gb;
-        }
-    }
-
-    bool Standings::teamRecordCompare(const TeamRecord& a, const TeamRecord& b)
-    {
-        // We sort by best "win%" or wins-loss difference
-        // e.g. if a has better W-L than b => a is earlier
-        // Let's do difference: (wins - losses)
-        int diffA = a.wins - a.losses;
-        int diffB = b.wins - b.losses;
-        if (diffA != diffB)
-            return diffA > diffB; // bigger diff => better
-        else
-        {
-            // tiebreak: if you want. We'll do lesser losses or by name
-            // for simplicity
-            return a.team->getName() < b.team->getName();
+            sorted[i].gamesBehind = gb;
         }
     }
 
@@ -1,5 +1,4 @@
 #include "StartingRotation.h"
-#include <iostream>  // if you want debug prints, else omit
 
 namespace BBEngine
 {
@@ -0,0 +1,34 @@
+#include "StatRegistry.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace BBEngine
+{
+    StatId parseStat(const std::string& name)
+    {
+        for (const StatInfo& info : StatRegistry)
+        {
+            if (name == info.name)
+                return info.id;
+        }
+        throw std::runtime_error("[StatRegistry] Unknown stat: " + name);
+    }
+
+    double qualifyingMinimum(StatId stat, int teamGames)
+    {
+        const StatInfo& info = getStatInfo(stat);
+        if (info.qualifier == Qualifier::None || teamGames <= 0)
+            return 0.0;
+        // a small epsilon so 3.1 * 10 doesn't come out as 30.999...
+        return std::floor(info.qualifyingPerTeamGame * teamGames + 1e-9);
+    }
+
+    AggregateMethod parseAggregateMethod(const std::string& name)
+    {
+        if (name == "AVG")
+            return AggregateMethod::Average;
+        // "SUM" and the old fallback
+        return AggregateMethod::Sum;
+    }
+
+} // namespace BBEngine
@@ -0,0 +1,345 @@
+#include "StatsHistory.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace BBEngine
+{
+    // -------------------------------------------------------
+    // Varint helpers (LEB128, zigzag for signed values)
+    // -------------------------------------------------------
+    namespace
+    {
+        void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                out.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        std::uint64_t readVarint(const std::uint8_t*& p)
+        {
+            std::uint64_t value = 0;
+            int shift = 0;
+            while (*p & 0x80)
+            {
+                value |= static_cast<std::uint64_t>(*p++ & 0x7F) << shift;
+                shift += 7;
+            }
+            value |= static_cast<std::uint64_t>(*p++) << shift;
+            return value;
+        }
+
+        void skipVarint(const std::uint8_t*& p)
+        {
+            while (*p++ & 0x80)
+            {
+            }
+        }
+
+        std::uint64_t zigzag(std::int64_t v)
+        {
+            return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63);
+        }
+
+        std::int64_t unzigzag(std::uint64_t v)
+        {
+            return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+        }
+
+        // The value at 'position' of a column stream, without decoding the ones before it
+        std::int64_t readVarintAt(const std::vector<std::uint8_t>& stream, int position)
+        {
+            const std::uint8_t* p = stream.data();
+            for (int i = 0; i < position; ++i)
+                skipVarint(p);
+            return unzigzag(readVarint(p));
+        }
+    }
+
+    // -------------------------------------------------------
+    // Appending
+    // -------------------------------------------------------
+    int StatsHistory::appendSeason(int year, int teamGames, const StatsTable& table, const std::vector<int>& playerIDs)
+    {
+        EncodedSeason season;
+        season.year = year;
+        season.teamGames = teamGames;
+        season.playerCount = static_cast<int>(playerIDs.size());
+
+        int previous = -1;
+        for (int id : playerIDs)
+        {
+            if (id <= previous || id >= static_cast<int>(table.size()))
+                throw std::invalid_argument("[StatsHistory] Player IDs must be ascending rows of the table.");
+            writeVarint(season.ids, static_cast<std::uint64_t>(id - previous - 1));
+            previous = id;
+        }
+
+        // Column by column, so each stream is read on its own later
+        for (std::size_t c = 0; c < StatColumnCount; ++c)
+        {
+            const std::int32_t* values = table.column(static_cast<StatColumn>(c));
+            for (int id : playerIDs)
+                writeVarint(season.columns[c], zigzag(values[id]));
+        }
+        const double* innings = table.inningsPitchedColumn();
+        for (int id : playerIDs)
+            writeVarint(season.innings, zigzag(std::llround(innings[id] * 100.0)));
+
+        if (previous + 1 > playerIDBound)
+            playerIDBound = previous + 1;
+
+        seasons.push_back(std::move(season));
+        return static_cast<int>(seasons.size()) - 1;
+    }
+
+    int StatsHistory::getSeasonCount() const
+    {
+        return static_cast<int>(seasons.size());
+    }
+
+    int StatsHistory::getSeasonYear(int seasonIndex) const
+    {
+        return getSeason(seasonIndex).year;
+    }
+
+    int StatsHistory::getSeasonTeamGames(int seasonIndex) const
+    {
+        return getSeason(seasonIndex).teamGames;
+    }
+
+    int StatsHistory::getSeasonPlayerCount(int seasonIndex) const
+    {
+        return getSeason(seasonIndex).playerCount;
+    }
+
+    int StatsHistory::getPlayerIDBound() const
+    {
+        return playerIDBound;
+    }
+
+    std::size_t StatsHistory::getEncodedBytes() const
+    {
+        std::size_t bytes = 0;
+        for (const EncodedSeason& season : seasons)
+        {
+            bytes += season.ids.size() + season.innings.size();
+            for (const auto& col : season.columns)
+                bytes += col.size();
+        }
+        return bytes;
+    }
+
+    // -------------------------------------------------------
+    // Splits & careers
+    // -------------------------------------------------------
+    void StatsHistory::loadSeason(int seasonIndex, StatsTable& out) const
+    {
+        const EncodedSeason& season = getSeason(seasonIndex);
+        out.resize(0);
+        out.resize(playerIDBound);
+
+        std::vector<int> ids = decodeIDs(season);
+        for (std::size_t c = 0; c < StatColumnCount; ++c)
+        {
+            const std::uint8_t* p = season.columns[c].data();
+            for (int id : ids)
+                out.set(static_cast<StatColumn>(c), id, static_cast<int>(unzigzag(readVarint(p))));
+        }
+        const std::uint8_t* p = season.innings.data();
+        for (int id : ids)
+            out.setInningsPitched(id, unzigzag(readVarint(p)) / 100.0);
+    }
+
+    void StatsHistory::loadCareer(StatsTable& out) const
+    {
+        out.resize(0);
+        out.resize(playerIDBound);
+
+        for (const EncodedSeason& season : seasons)
+        {
+            std::vector<int> ids = decodeIDs(season);
+            for (std::size_t c = 0; c < StatColumnCount; ++c)
+            {
+                const std::uint8_t* p = season.columns[c].data();
+                for (int id : ids)
+                    out.add(static_cast<StatColumn>(c), id, static_cast<int>(unzigzag(readVarint(p))));
+            }
+            const std::uint8_t* p = season.innings.data();
+            for (int id : ids)
+                out.addInningsPitched(id, unzigzag(readVarint(p)) / 100.0);
+        }
+    }
+
+    long long StatsHistory::getCareerTotal(StatColumn column, int playerID) const
+    {
+        long long total = 0;
+        for (const EncodedSeason& season : seasons)
+        {
+            const std::uint8_t* idPtr = season.ids.data();
+            const std::uint8_t* valuePtr = season.columns[static_cast<std::size_t>(column)].data();
+            int id = -1;
+            for (int i = 0; i < season.playerCount; ++i)
+            {
+                id += static_cast<int>(readVarint(idPtr)) + 1;
+                std::int64_t value = unzigzag(readVarint(valuePtr));
+                if (id == playerID)
+                {
+                    total += value;
+                    break;
+                }
+                if (id > playerID)
+                    break; // IDs are ascending: not in this season
+            }
+        }
+        return total;
+    }
+
+    // -------------------------------------------------------
+    // Best seasons
+    // -------------------------------------------------------
+    template<typename Visit>
+    void StatsHistory::forEachSeasonValue(int seasonIndex, StatId stat, bool qualifiedOnly, Visit visit) const
+    {
+        const EncodedSeason& season = getSeason(seasonIndex);
+
+        StatsTable table;
+        loadSeason(seasonIndex, table);
+        std::vector<double> values;
+        getStatInfo(stat).column(table, values);
+
+        // Rate stats: only seasons that met that year's minimum
+        std::vector<std::uint8_t> qualified;
+        const double minimum = qualifiedOnly ? qualifyingMinimum(stat, season.teamGames) : 0.0;
+        if (minimum > 0.0)
+        {
+            if (getStatInfo(stat).qualifier == Qualifier::PlateAppearances)
+                table.computePlateAppearanceMask(minimum, qualified);
+            else
+                table.computeInningsPitchedMask(minimum, qualified);
+        }
+
+        for (int id : decodeIDs(season))
+        {
+            if (qualified.empty() || qualified[id])
+                visit(id, values[id]);
+        }
+    }
+
+    std::vector<StatsHistory::SeasonRecord> StatsHistory::getBestSeasons(StatId stat, int topN, bool qualifiedOnly) const
+    {
+        std::vector<SeasonRecord> records;
+        if (topN <= 0)
+            return records;
+
+        for (int s = 0; s < getSeasonCount(); ++s)
+        {
+            const int year = seasons[s].year;
+            forEachSeasonValue(s, stat, qualifiedOnly, [&](int id, double value)
+            {
+                records.push_back({ id, year, value });
+            });
+        }
+
+        // Best value first; ties go to the earlier season, then the lower ID
+        const bool ascending = getStatInfo(stat).direction == SortDirection::LowerIsBetter;
+        auto better = [ascending](const SeasonRecord& a, const SeasonRecord& b)
+        {
+            if (a.value != b.value)
+                return ascending ? (a.value < b.value) : (a.value > b.value);
+            if (a.year != b.year)
+                return a.year < b.year;
+            return a.playerID < b.playerID;
+        };
+
+        const std::size_t keep = std::min(records.size(), static_cast<std::size_t>(topN));
+        std::partial_sort(records.begin(), records.begin() + keep, records.end(), better);
+        records.resize(keep);
+        return records;
+    }
+
+    StatsHistory::SeasonRecord StatsHistory::getPlayerBestSeason(StatId stat, int playerID, bool qualifiedOnly) const
+    {
+        SeasonRecord best{ -1, 0, 0.0 };
+        const StatInfo& info = getStatInfo(stat);
+        const bool ascending = info.direction == SortDirection::LowerIsBetter;
+
+        // Only the player's own row is ever decoded: a one-row table per season
+        StatsTable row;
+        row.resize(1);
+        std::vector<double> value;
+        std::vector<std::uint8_t> qualified;
+        for (int s = 0; s < getSeasonCount(); ++s)
+        {
+            const EncodedSeason& season = seasons[s];
+            const int position = findPosition(season, playerID);
+            if (position < 0)
+                continue;
+
+            for (std::size_t c = 0; c < StatColumnCount; ++c)
+                row.set(static_cast<StatColumn>(c), 0, static_cast<int>(readVarintAt(season.columns[c], position)));
+            row.setInningsPitched(0, readVarintAt(season.innings, position) / 100.0);
+
+            const double minimum = qualifiedOnly ? qualifyingMinimum(stat, season.teamGames) : 0.0;
+            if (minimum > 0.0)
+            {
+                if (info.qualifier == Qualifier::PlateAppearances)
+                    row.computePlateAppearanceMask(minimum, qualified);
+                else
+                    row.computeInningsPitchedMask(minimum, qualified);
+                if (!qualified[0])
+                    continue;
+            }
+
+            info.column(row, value);
+            bool improves = best.playerID < 0 || (ascending ? value[0] < best.value : value[0] > best.value);
+            if (improves)
+                best = { playerID, season.year, value[0] };
+        }
+        return best;
+    }
+
+    // -------------------------------------------------------
+    // Private Helpers
+    // -------------------------------------------------------
+    const StatsHistory::EncodedSeason& StatsHistory::getSeason(int seasonIndex) const
+    {
+        if (seasonIndex < 0 || seasonIndex >= getSeasonCount())
+            throw std::out_of_range("[StatsHistory] No season with that index.");
+        return seasons[seasonIndex];
+    }
+
+    int StatsHistory::findPosition(const EncodedSeason& season, int playerID)
+    {
+        const std::uint8_t* p = season.ids.data();
+        int id = -1;
+        for (int i = 0; i < season.playerCount; ++i)
+        {
+            id += static_cast<int>(readVarint(p)) + 1;
+            if (id == playerID)
+                return i;
+            if (id > playerID)
+                break; // IDs are ascending: not in this season
+        }
+        return -1;
+    }
+
+    std::vector<int> StatsHistory::decodeIDs(const EncodedSeason& season)
+    {
+        std::vector<int> ids;
+        ids.reserve(season.playerCount);
+        const std::uint8_t* p = season.ids.data();
+        int id = -1;
+        for (int i = 0; i < season.playerCount; ++i)
+        {
+            id += static_cast<int>(readVarint(p)) + 1;
+            ids.push_back(id);
+        }
+        return ids;
+    }
+
+} // namespace BBEngine
@@ -1,7 +1,6 @@
 #include "StatsManager.h"
 #include "PlayerStats.h"
 #include <algorithm>
-#include <iostream>
 #include <stdexcept>
 #include <cmath> // for possible rounding
 
@@ -12,206 +11,494 @@ namespace BBEngine
     }
 
     StatsManager::StatsManager(const std::vector<Player*>& initialPlayers)
-        : allPlayers(initialPlayers)
     {
+        table.reserve(initialPlayers.size());
+        for (auto* p : initialPlayers)
+            registerPlayer(p);
     }
 
     void StatsManager::registerPlayer(Player* player)
     {
         if (!player) return;
-        // Optionally check if already in vector
-        allPlayers.push_back(player);
+        // Already tracked => keep its ID
+        if (idByPlayer.count(player)) return;
+
+        int id = table.addPlayer();
+        playersByID.push_back(player);
+        idByPlayer.emplace(player, id);
+        loadedRows.emplace_back();
+        registeredCount++;
+
+        loadRow(id);
+
+        for (auto& board : leaderboards)
+        {
+            if (board)
+                board->update(id, getStatValue(player, board->getStat()));
+        }
     }
 
     void StatsManager::unregisterPlayer(Player* player)
     {
-        auto it = std::find(allPlayers.begin(), allPlayers.end(), player);
-        if (it != allPlayers.end())
+        auto it = idByPlayer.find(player);
+        if (it != idByPlayer.end())
+        {
+            // Leave a tombstone so every other ID stays put
+            playersByID[it->second] = nullptr;
+            table.clearRow(it->second);
+            loadedRows[it->second] = LoadedRow();
+            for (auto& board : leaderboards)
+            {
+                if (board)
+                    board->remove(it->second);
+            }
+            idByPlayer.erase(it);
+            registeredCount--;
+        }
+    }
+
+    int StatsManager::getPlayerID(Player* player) const
+    {
+        auto it = idByPlayer.find(player);
+        return (it == idByPlayer.end()) ? -1 : it->second;
+    }
+
+    Player* StatsManager::getPlayer(int playerID) const
+    {
+        if (playerID < 0 || playerID >= static_cast<int>(playersByID.size()))
+            return nullptr;
+        return playersByID[playerID];
+    }
+
+    int StatsManager::getRegisteredCount() const
+    {
+        return registeredCount;
+    }
+
+    void StatsManager::refreshStats()
+    {
+        syncTable();
+
+        // Everyone may have moved, so re-rank the subscribed boards too
+        for (auto& board : leaderboards)
         {
-            allPlayers.erase(it);
+            if (board)
+                fillLeaderboard(*board);
         }
     }
 
+    void StatsManager::loadRow(int id)
+    {
+        const PlayerStats* stats = playersByID[id]->getStats();
+        if (stats)
+            table.load(id, *stats);
+        else
+            table.clearRow(id);
+        loadedRows[id] = LoadedRow{ stats, stats ? stats->getVersion() : 0 };
+    }
+
+    void StatsManager::syncTable()
+    {
+        for (size_t id = 0; id < playersByID.size(); ++id)
+        {
+            Player* p = playersByID[id];
+            if (!p)
+                continue;
+            const PlayerStats* stats = p->getStats();
+            const LoadedRow& row = loadedRows[id];
+            if (stats != row.stats || (stats && stats->getVersion() != row.version))
+                loadRow(static_cast<int>(id));
+        }
+    }
+
+    const StatsTable& StatsManager::getStatsTable() const
+    {
+        return table;
+    }
+
     std::vector<std::pair<Player*, double>>
         StatsManager::getLeaders(const std::string& stat, int topN, bool ascending)
+    {
+        // The only string work: once, here
+        return getLeaders(parseStat(stat), topN, ascending);
+    }
+
+    std::vector<std::pair<Player*, double>> StatsManager::getLeaders(StatId stat, int topN)
+    {
+        return getLeaders(stat, topN, getStatInfo(stat).direction == SortDirection::LowerIsBetter);
+    }
+
+    std::vector<std::pair<Player*, double>>
+        StatsManager::getLeaders(StatId stat, int topN, bool ascending)
+    {
+        // Reload whoever changed, then one kernel pass over the table
+        syncTable();
+        getStatInfo(stat).column(table, statColumn);
+
+        return selectTop(statColumn, topN, ascending);
+    }
+
+    std::vector<std::pair<Player*, double>>
+        StatsManager::getQualifiedLeaders(const std::string& stat, int topN, int teamGames)
+    {
+        return getQualifiedLeaders(parseStat(stat), topN, teamGames);
+    }
+
+    std::vector<std::pair<Player*, double>> StatsManager::getQualifiedLeaders(StatId stat, int topN, int teamGames)
+    {
+        return getQualifiedLeaders(stat, topN, teamGames,
+            getStatInfo(stat).direction == SortDirection::LowerIsBetter);
+    }
+
+    std::vector<std::pair<Player*, double>>
+        StatsManager::getQualifiedLeaders(StatId stat, int topN, int teamGames, bool ascending)
+    {
+        syncTable();
+        getStatInfo(stat).column(table, statColumn);
+
+        if (!computeQualificationMask(stat, teamGames, qualifiedMask))
+            return selectTop(statColumn, topN, ascending);
+        return selectTop(statColumn, topN, ascending, &qualifiedMask);
+    }
+
+    bool StatsManager::computeQualificationMask(StatId stat, int teamGames,
+        std::vector<std::uint8_t>& qualified) const
+    {
+        const double minimum = qualifyingMinimum(stat, teamGames);
+        if (minimum <= 0.0)
+            return false;
+
+        switch (getStatInfo(stat).qualifier)
+        {
+        case Qualifier::PlateAppearances:
+            table.computePlateAppearanceMask(minimum, qualified);
+            return true;
+        case Qualifier::InningsPitched:
+            table.computeInningsPitchedMask(minimum, qualified);
+            return true;
+        case Qualifier::None:
+            break;
+        }
+        return false;
+    }
+
+    // ----------------------------------------------------
+    // Maintained leaderboards
+    // ----------------------------------------------------
+    int StatsManager::subscribeLeaderboard(StatId stat)
+    {
+        return subscribeLeaderboard(stat, getStatInfo(stat).direction == SortDirection::LowerIsBetter);
+    }
+
+    int StatsManager::subscribeLeaderboard(StatId stat, bool ascending)
+    {
+        auto board = std::make_unique<Leaderboard>(stat, ascending);
+        syncTable();
+        fillLeaderboard(*board);
+        leaderboards.push_back(std::move(board));
+        return static_cast<int>(leaderboards.size()) - 1;
+    }
+
+    void StatsManager::unsubscribeLeaderboard(int subscription)
+    {
+        if (subscription >= 0 && subscription < static_cast<int>(leaderboards.size()))
+            leaderboards[subscription].reset();
+    }
+
+    std::vector<std::pair<Player*, double>> StatsManager::getSubscribedLeaders(int subscription, int topN) const
     {
         std::vector<std::pair<Player*, double>> results;
-        results.reserve(allPlayers.size());
+        for (const auto& entry : getLeaderboard(subscription).top(topN))
+            results.push_back({ playersByID[entry.first], entry.second });
+        return results;
+    }
 
-        // Fill with (player, statValue)
-        for (auto* p : allPlayers)
+    void StatsManager::notifyStatsChanged(Player* player)
+    {
+        auto it = idByPlayer.find(player);
+        if (it == idByPlayer.end())
+            return; // not one of ours
+
+        const int id = it->second;
+        loadRow(id);
+
+        for (auto& board : leaderboards)
         {
-            double val = getStatValue(p, stat);
-            results.push_back({ p, val });
+            if (board)
+                board->update(id, getStatValue(player, board->getStat()));
         }
+    }
 
-        // Sort by the second field
-        // If ascending, a < b => ascending, else descending
-        if (ascending)
+    void StatsManager::fillLeaderboard(Leaderboard& board)
+    {
+        std::vector<double> column;
+        getStatInfo(board.getStat()).column(table, column);
+        for (size_t id = 0; id < playersByID.size(); ++id)
         {
-            std::sort(results.begin(), results.end(),
-                [](auto& a, auto& b) { return a.second < b.second; });
+            if (playersByID[id])
+                board.update(static_cast<int>(id), column[id]);
         }
-        else
+    }
+
+    const Leaderboard& StatsManager::getLeaderboard(int subscription) const
+    {
+        if (subscription < 0 || subscription >= static_cast<int>(leaderboards.size())
+            || !leaderboards[subscription])
         {
-            std::sort(results.begin(), results.end(),
-                [](auto& a, auto& b) { return a.second > b.second; });
+            throw std::out_of_range("[StatsManager] No leaderboard with that subscription ID.");
         }
+        return *leaderboards[subscription];
+    }
 
-        // clamp topN
-        if (topN > static_cast<int>(results.size()))
-            topN = static_cast<int>(results.size());
+    std::vector<std::pair<Player*, double>> StatsManager::selectTop(const std::vector<double>& values,
+        int topN, bool ascending, const std::vector<std::uint8_t>* qualified) const
+    {
+        std::vector<std::pair<Player*, double>> results;
+        if (topN <= 0)
+            return results;
+
+        // Max-heap under "ranks ahead": the front is the worst of the current best topN,
+        // which is the one a better newcomer replaces.
+        struct Candidate { double value; int id; };
+        auto ahead = [ascending](const Candidate& a, const Candidate& b)
+        {
+            return Leaderboard::ranksAhead(a.value, a.id, b.value, b.id, ascending);
+        };
+
+        std::vector<Candidate> heap;
+        heap.reserve(std::min(topN, registeredCount));
+        for (size_t id = 0; id < playersByID.size(); ++id)
+        {
+            if (!playersByID[id] || (qualified && !(*qualified)[id]))
+                continue;
 
-        results.resize(topN);
+            Candidate c{ values[id], static_cast<int>(id) };
+            if (static_cast<int>(heap.size()) < topN)
+            {
+                heap.push_back(c);
+                std::push_heap(heap.begin(), heap.end(), ahead);
+            }
+            else if (ahead(c, heap.front()))
+            {
+                std::pop_heap(heap.begin(), heap.end(), ahead);
+                heap.back() = c;
+                std::push_heap(heap.begin(), heap.end(), ahead);
+            }
+        }
+
+        // Best first
+        std::sort_heap(heap.begin(), heap.end(), ahead);
+        results.reserve(heap.size());
+        for (const Candidate& c : heap)
+            results.push_back({ playersByID[c.id], c.value });
         return results;
     }
 
+    // ----------------------------------------------------
+    // Multi-season history
+    // ----------------------------------------------------
+    int StatsManager::archiveSeason(int year, int teamGames, bool resetPlayerStats)
+    {
+        syncTable();
+
+        std::vector<int> ids;
+        ids.reserve(registeredCount);
+        for (size_t id = 0; id < playersByID.size(); ++id)
+        {
+            if (playersByID[id])
+                ids.push_back(static_cast<int>(id));
+        }
+        int seasonIndex = history.appendSeason(year, teamGames, table, ids);
+        totalTeamGames += teamGames;
+
+        // The finished season, and every career including it (retired players too)
+        recordBook.update(RecordScope::SingleSeason, year, table, ids, teamGames);
+
+        StatsTable careers;
+        history.loadCareer(careers);
+        std::vector<int> careerIDs(careers.size());
+        for (size_t id = 0; id < careerIDs.size(); ++id)
+            careerIDs[id] = static_cast<int>(id);
+        recordBook.update(RecordScope::Career, year, careers, careerIDs, totalTeamGames);
+
+        if (resetPlayerStats)
+        {
+            for (Player* p : playersByID)
+            {
+                if (p && p->getStats())
+                    p->getStats()->resetStats();
+            }
+            refreshStats();
+        }
+        return seasonIndex;
+    }
+
+    const StatsHistory& StatsManager::getHistory() const
+    {
+        return history;
+    }
+
     double StatsManager::getTeamStat(Team* team,
         const std::string& stat,
         const std::string& aggregateMethod)
+    {
+        return getTeamStat(team, parseStat(stat), parseAggregateMethod(aggregateMethod));
+    }
+
+    double StatsManager::getTeamStat(Team* team, StatId stat, AggregateMethod method)
     {
         if (!team) return 0.0;
         double sum = 0.0;
         int count = 0;
 
+        // Registered players come from the (synced) table like every other query; anybody else
+        // straight from their PlayerStats. Either way it's the current value.
+        syncTable();
+        getStatInfo(stat).column(table, statColumn);
+
         // for each player in team->getRoster()
         const auto& roster = team->getRoster();
         for (auto* p : roster)
         {
-            double val = getStatValue(p, stat);
+            auto it = idByPlayer.find(p);
+            double val = (it != idByPlayer.end()) ? statColumn[it->second] : getStatValue(p, stat);
             sum += val;
             count++;
         }
 
         if (count == 0) return 0.0;
 
-        if (aggregateMethod == "SUM")
-        {
-            return sum;
-        }
-        else if (aggregateMethod == "AVG")
+        if (method == AggregateMethod::Average)
         {
             return (sum / count);
         }
-        // fallback 
         return sum;
     }
 
     void StatsManager::checkAndUpdateAllTimeRecord(Player* player, const std::string& stat)
     {
-        double currentVal = getStatValue(player, stat);
+        checkAndUpdateAllTimeRecord(player, parseStat(stat));
+    }
+
+    void StatsManager::checkAndUpdateAllTimeRecord(Player* player, StatId statId)
+    {
+        if (!player) return;
+        double currentVal = getStatValue(player, statId);
 
-        auto it = allTimeRecords.find(stat);
-        if (it == allTimeRecords.end())
+        AllTimeRecord& rec = allTimeRecords[static_cast<size_t>(statId)];
+        // No record for this stat yet, or the new value beats it
+        if (!rec.recordHolder || currentVal > rec.recordValue)
         {
-            // This means we have no record for this stat yet, so set it
-            AllTimeRecord rec;
             rec.recordValue = currentVal;
             rec.recordHolder = player;
-            allTimeRecords[stat] = rec;
-            std::cout << "[StatsManager] New all-time record for stat=" << stat
-                << ": " << currentVal << " by " << player->getName() << "\n";
-        }
-        else
-        {
-            // Compare with existing record
-            if (currentVal > it->second.recordValue)
-            {
-                it->second.recordValue = currentVal;
-                it->second.recordHolder = player;
-
-                std::cout << "[StatsManager] " << player->getName()
-                    << " set a new record in " << stat
-                    << " with " << currentVal << "\n";
-            }
         }
     }
 
     StatsManager::AllTimeRecord StatsManager::getAllTimeRecord(const std::string& stat) const
     {
-        auto it = allTimeRecords.find(stat);
-        if (it == allTimeRecords.end())
+        return getAllTimeRecord(parseStat(stat));
+    }
+
+    StatsManager::AllTimeRecord StatsManager::getAllTimeRecord(StatId stat) const
+    {
+        const AllTimeRecord& rec = allTimeRecords[static_cast<size_t>(stat)];
+        if (!rec.recordHolder)
         {
             // return default or throw
-            throw std::runtime_error("No all-time record found for stat = " + stat);
+            throw std::runtime_error(std::string("No all-time record found for stat = ") + getStatInfo(stat).name);
         }
-        return it->second;
+        return rec;
     }
 
-    // This is the "heart" of stat retrieval. 
-    // We'll expand the if-else for more stats. 
-    double StatsManager::getStatValue(Player* player, const std::string& stat) const
+    // ----------------------------------------------------
+    // Record book
+    // ----------------------------------------------------
+    void StatsManager::recordGame(int gameID, const BoxScore& box)
     {
-        auto* ps = player->getStats();
-        if (!ps) return 0.0;
-
-        // Example usage: we assume your PlayerStats has methods like 
-        // getAtBats(), getHits(), getWalks(), getHomeRuns(), getRBI(), getERA()...
-        // We'll define them in if-else:
+        gameTable.resize(playersByID.size());
 
-        if (stat == "AVG")
+        // Only the players in this game get a (scratch) row
+        std::vector<int> ids;
+        auto rowFor = [&](Player* p)
         {
-            int ab = ps->getAtBats();
-            int h = ps->getHits();
-            if (ab == 0) return 0.0;
-            return static_cast<double>(h) / ab;
-        }
-        else if (stat == "OBP")
-        {
-            // OBP = (H + BB) / (AB + BB + SF...) we keep it simple
-            int ab = ps->getAtBats();
-            int h = ps->getHits();
-            int bb = ps->getWalks();
-            // ignoring HBP, sac flies, etc. for brevity
-            int denom = ab + bb;
-            if (denom == 0) return 0.0;
-            return static_cast<double>(h + bb) / denom;
-        }
-        else if (stat == "SLG")
-        {
-            // Suppose we have getSingles, getDoubles, getTriples, getHomeRuns?
-            // We'll do a rough approach: totalBases / AB
-            int ab = ps->getAtBats();
-            if (ab == 0) return 0.0;
-            int singles = ps->getHits() - (ps->getDoubles() + ps->getTriples() + ps->getHomeRuns());
-            int totalBases = singles + 2 * ps->getDoubles() + 3 * ps->getTriples() + 4 * ps->getHomeRuns();
-            return static_cast<double>(totalBases) / ab;
-        }
-        else if (stat == "OPS")
-        {
-            // OPS = OBP + SLG
-            double obp = getStatValue(player, "OBP");
-            double slg = getStatValue(player, "SLG");
-            return obp + slg;
-        }
-        else if (stat == "HR")
-        {
-            return static_cast<double>(ps->getHomeRuns());
-        }
-        else if (stat == "RBI")
-        {
-            return static_cast<double>(ps->getRBIs());
-        }
-        else if (stat == "ERA")
+            auto it = idByPlayer.find(p);
+            if (it == idByPlayer.end())
+                return -1;
+            ids.push_back(it->second);
+            return it->second;
+        };
+
+        for (const auto* lines : { &box.getHomeBattingLines(), &box.getAwayBattingLines() })
         {
-            // (ER * 9) / IP
-            double ip = ps->getInningsPitched();
-            if (ip <= 0.0) return 99.99;
-            int er = ps->getEarnedRuns();
-            return (er * 9.0) / ip;
+            for (const BoxScoreBattingLine& line : *lines)
+            {
+                int id = rowFor(line.player);
+                if (id < 0) continue;
+                gameTable.add(StatColumn::AtBats, id, line.atBats);
+                gameTable.add(StatColumn::Hits, id, line.hits);
+                gameTable.add(StatColumn::Doubles, id, line.doubles_);
+                gameTable.add(StatColumn::Triples, id, line.triples);
+                gameTable.add(StatColumn::HomeRuns, id, line.homeRuns);
+                gameTable.add(StatColumn::RBIs, id, line.runsBattedIn);
+                gameTable.add(StatColumn::Walks, id, line.walks);
+                gameTable.add(StatColumn::Strikeouts, id, line.strikeouts);
+                gameTable.add(StatColumn::Runs, id, line.runsScored);
+            }
         }
-        else if (stat == "WHIP")
+        for (const auto* lines : { &box.getHomePitchingLines(), &box.getAwayPitchingLines() })
         {
-            // (walks + hits) / IP
-            double ip = ps->getInningsPitched();
-            if (ip <= 0.0) return 99.99;
-            double wh = ps->getWalksAllowed() + ps->getHitsAllowed();
-            return (wh / ip);
+            for (const BoxScorePitchingLine& line : *lines)
+            {
+                int id = rowFor(line.pitcher);
+                if (id < 0) continue;
+                gameTable.addInningsPitched(id, line.inningsPitched);
+                gameTable.add(StatColumn::HitsAllowed, id, line.hitsAllowed);
+                gameTable.add(StatColumn::RunsAllowed, id, line.runsAllowed);
+                gameTable.add(StatColumn::EarnedRuns, id, line.earnedRuns);
+                gameTable.add(StatColumn::WalksAllowed, id, line.walksAllowed);
+                gameTable.add(StatColumn::PitcherStrikeouts, id, line.strikeouts);
+            }
         }
-        else
+
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        recordBook.update(RecordScope::SingleGame, gameID, gameTable, ids, 0);
+
+        // Leave the scratch table all zeros for the next game
+        for (int id : ids)
+            gameTable.clearRow(id);
+    }
+
+    void StatsManager::updateSeasonRecords(int year, int teamGames)
+    {
+        syncTable();
+
+        std::vector<int> ids;
+        ids.reserve(registeredCount);
+        for (size_t id = 0; id < playersByID.size(); ++id)
         {
-            // not recognized
-            throw std::runtime_error("[StatsManager::getStatValue] Unknown stat: " + stat);
+            if (playersByID[id])
+                ids.push_back(static_cast<int>(id));
         }
+        recordBook.update(RecordScope::SingleSeason, year, table, ids, teamGames);
+    }
+
+    RecordBook& StatsManager::getRecordBook()
+    {
+        return recordBook;
+    }
+
+    const RecordBook& StatsManager::getRecordBook() const
+    {
+        return recordBook;
+    }
+
+    // This is the "heart" of stat retrieval: the formula comes from the stat registry,
+    // so adding a stat never touches this function.
+    double StatsManager::getStatValue(Player* player, StatId stat) const
+    {
+        auto* ps = player->getStats();
+        if (!ps) return 0.0;
+        return getStatInfo(stat).value(*ps);
     }
 }
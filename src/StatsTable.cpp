@@ -0,0 +1,248 @@
+#include "StatsTable.h"
+#include "PlayerStats.h"
+
+namespace BBEngine
+{
+    // -------------------------------------------------------
+    // Rows
+    // -------------------------------------------------------
+    int StatsTable::addPlayer()
+    {
+        for (auto& col : columns)
+            col.push_back(0);
+        inningsPitched.push_back(0.0);
+        return static_cast<int>(inningsPitched.size()) - 1;
+    }
+
+    void StatsTable::reserve(std::size_t players)
+    {
+        for (auto& col : columns)
+            col.reserve(players);
+        inningsPitched.reserve(players);
+    }
+
+    std::size_t StatsTable::size() const
+    {
+        return inningsPitched.size();
+    }
+
+    void StatsTable::resize(std::size_t players)
+    {
+        for (auto& col : columns)
+            col.resize(players, 0);
+        inningsPitched.resize(players, 0.0);
+    }
+
+    void StatsTable::load(int playerID, const PlayerStats& stats)
+    {
+        auto set = [this, playerID](StatColumn c, int value)
+        {
+            columns[static_cast<std::size_t>(c)][playerID] = value;
+        };
+
+        set(StatColumn::AtBats, stats.getAtBats());
+        set(StatColumn::Hits, stats.getHits());
+        set(StatColumn::Doubles, stats.getDoubles());
+        set(StatColumn::Triples, stats.getTriples());
+        set(StatColumn::HomeRuns, stats.getHomeRuns());
+        set(StatColumn::Walks, stats.getWalks());
+        set(StatColumn::Strikeouts, stats.getStrikeouts());
+        set(StatColumn::Runs, stats.getRuns());
+        set(StatColumn::RBIs, stats.getRBIs());
+
+        set(StatColumn::HitsAllowed, stats.getHitsAllowed());
+        set(StatColumn::RunsAllowed, stats.getRunsAllowed());
+        set(StatColumn::EarnedRuns, stats.getEarnedRuns());
+        set(StatColumn::WalksAllowed, stats.getWalksAllowed());
+        set(StatColumn::PitcherStrikeouts, stats.getPitcherStrikeouts());
+        set(StatColumn::Wins, stats.getWins());
+        set(StatColumn::Losses, stats.getLosses());
+        set(StatColumn::Saves, stats.getSaves());
+
+        inningsPitched[playerID] = stats.getInningsPitched();
+    }
+
+    void StatsTable::clearRow(int playerID)
+    {
+        for (auto& col : columns)
+            col[playerID] = 0;
+        inningsPitched[playerID] = 0.0;
+    }
+
+    // -------------------------------------------------------
+    // Cell / column access
+    // -------------------------------------------------------
+    int StatsTable::get(StatColumn column, int playerID) const
+    {
+        return columns[static_cast<std::size_t>(column)][playerID];
+    }
+
+    void StatsTable::set(StatColumn column, int playerID, int value)
+    {
+        columns[static_cast<std::size_t>(column)][playerID] = value;
+    }
+
+    void StatsTable::add(StatColumn column, int playerID, int count)
+    {
+        columns[static_cast<std::size_t>(column)][playerID] += count;
+    }
+
+    double StatsTable::getInningsPitched(int playerID) const
+    {
+        return inningsPitched[playerID];
+    }
+
+    void StatsTable::setInningsPitched(int playerID, double innings)
+    {
+        inningsPitched[playerID] = innings;
+    }
+
+    void StatsTable::addInningsPitched(int playerID, double innings)
+    {
+        inningsPitched[playerID] += innings;
+    }
+
+    const std::int32_t* StatsTable::column(StatColumn column) const
+    {
+        return columns[static_cast<std::size_t>(column)].data();
+    }
+
+    const double* StatsTable::inningsPitchedColumn() const
+    {
+        return inningsPitched.data();
+    }
+
+    // -------------------------------------------------------
+    // Kernels
+    //
+    // Empty denominators are handled with a select rather than an early return:
+    // divide by max(denominator, 1) and then pick the fallback, so every lane
+    // does the same work.
+    // -------------------------------------------------------
+    void StatsTable::computeCounter(StatColumn c, std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const std::int32_t* v = column(c);
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = static_cast<double>(v[i]);
+    }
+
+    void StatsTable::computeBattingAverage(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const std::int32_t* ab = column(StatColumn::AtBats);
+        const std::int32_t* h = column(StatColumn::Hits);
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double denom = static_cast<double>(ab[i] > 0 ? ab[i] : 1);
+            out[i] = ab[i] > 0 ? h[i] / denom : 0.0;
+        }
+    }
+
+    void StatsTable::computeOnBasePercentage(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const std::int32_t* ab = column(StatColumn::AtBats);
+        const std::int32_t* h = column(StatColumn::Hits);
+        const std::int32_t* bb = column(StatColumn::Walks);
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::int32_t pa = ab[i] + bb[i];
+            double denom = static_cast<double>(pa > 0 ? pa : 1);
+            out[i] = pa > 0 ? (h[i] + bb[i]) / denom : 0.0;
+        }
+    }
+
+    void StatsTable::computeSlugging(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const std::int32_t* ab = column(StatColumn::AtBats);
+        const std::int32_t* h = column(StatColumn::Hits);
+        const std::int32_t* d = column(StatColumn::Doubles);
+        const std::int32_t* t = column(StatColumn::Triples);
+        const std::int32_t* hr = column(StatColumn::HomeRuns);
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // singles + 2*2B + 3*3B + 4*HR == H + 2B + 2*3B + 3*HR
+            std::int32_t totalBases = h[i] + d[i] + 2 * t[i] + 3 * hr[i];
+            double denom = static_cast<double>(ab[i] > 0 ? ab[i] : 1);
+            out[i] = ab[i] > 0 ? totalBases / denom : 0.0;
+        }
+    }
+
+    void StatsTable::computeOPS(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const std::int32_t* ab = column(StatColumn::AtBats);
+        const std::int32_t* h = column(StatColumn::Hits);
+        const std::int32_t* d = column(StatColumn::Doubles);
+        const std::int32_t* t = column(StatColumn::Triples);
+        const std::int32_t* hr = column(StatColumn::HomeRuns);
+        const std::int32_t* bb = column(StatColumn::Walks);
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::int32_t pa = ab[i] + bb[i];
+            double obp = pa > 0 ? (h[i] + bb[i]) / static_cast<double>(pa > 0 ? pa : 1) : 0.0;
+
+            std::int32_t totalBases = h[i] + d[i] + 2 * t[i] + 3 * hr[i];
+            double slg = ab[i] > 0 ? totalBases / static_cast<double>(ab[i] > 0 ? ab[i] : 1) : 0.0;
+
+            out[i] = obp + slg;
+        }
+    }
+
+    void StatsTable::computeERA(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const double* ip = inningsPitchedColumn();
+        const std::int32_t* er = column(StatColumn::EarnedRuns);
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double denom = ip[i] > 0.0 ? ip[i] : 1.0;
+            out[i] = ip[i] > 0.0 ? (er[i] * 9.0) / denom : NoInningsRate;
+        }
+    }
+
+    void StatsTable::computeWHIP(std::vector<double>& out) const
+    {
+        const std::size_t n = size();
+        const double* ip = inningsPitchedColumn();
+        const std::int32_t* h = column(StatColumn::HitsAllowed);
+        const std::int32_t* bb = column(StatColumn::WalksAllowed);
+        out.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double denom = ip[i] > 0.0 ? ip[i] : 1.0;
+            out[i] = ip[i] > 0.0 ? static_cast<double>(bb[i] + h[i]) / denom : NoInningsRate;
+        }
+    }
+
+    // -------------------------------------------------------
+    // Qualification masks
+    // -------------------------------------------------------
+    void StatsTable::computePlateAppearanceMask(double minimum, std::vector<std::uint8_t>& mask) const
+    {
+        const std::size_t n = size();
+        const std::int32_t* ab = column(StatColumn::AtBats);
+        const std::int32_t* bb = column(StatColumn::Walks);
+        mask.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            mask[i] = static_cast<std::uint8_t>(static_cast<double>(ab[i] + bb[i]) >= minimum);
+    }
+
+    void StatsTable::computeInningsPitchedMask(double minimum, std::vector<std::uint8_t>& mask) const
+    {
+        const std::size_t n = size();
+        const double* ip = inningsPitchedColumn();
+        mask.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            mask[i] = static_cast<std::uint8_t>(ip[i] >= minimum);
+    }
+
+} // namespace BBEngine
@@ -0,0 +1,148 @@
+#include "ThreadPool.h"
+
+namespace BBEngine
+{
+    ThreadPool::ThreadPool(int threadCount)
+        : currentTask(nullptr),
+        taskCount(0),
+        nextIndex(0),
+        generation(0),
+        busyWorkers(0),
+        stopping(false)
+    {
+        if (threadCount <= 0)
+        {
+            threadCount = static_cast<int>(std::thread::hardware_concurrency());
+            if (threadCount <= 0) threadCount = 1;
+        }
+
+        // Worker 0 is whoever calls parallelFor(), so we only spawn the rest
+        threads.reserve(threadCount - 1);
+        for (int i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        workReady.notify_all();
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+
+    int ThreadPool::getThreadCount() const
+    {
+        return static_cast<int>(threads.size()) + 1;
+    }
+
+    void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t, int)>& task)
+    {
+        if (count == 0)
+            return;
+
+        // Single worker (or a single task): no point waking anybody up. Errors are handled
+        // like on the threaded path: every task still runs, then the first error is rethrown.
+        if (threads.empty() || count == 1)
+        {
+            std::exception_ptr error;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                try
+                {
+                    task(i, 0);
+                }
+                catch (...)
+                {
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            if (error)
+                std::rethrow_exception(error);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            currentTask = &task;
+            taskCount = count;
+            nextIndex.store(0, std::memory_order_relaxed);
+            busyWorkers = static_cast<int>(threads.size());
+            firstError = nullptr;
+            ++generation;
+        }
+        workReady.notify_all();
+
+        // The calling thread pitches in as worker 0
+        runTasks(0);
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workDone.wait(lock, [this] { return busyWorkers == 0; });
+            currentTask = nullptr;
+            error = firstError;
+            firstError = nullptr;
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    // ----------------------------------------------------
+    // Private helpers
+    // ----------------------------------------------------
+    void ThreadPool::workerLoop(int workerIndex)
+    {
+        unsigned long long seenGeneration = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                workReady.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                if (stopping)
+                    return;
+                seenGeneration = generation;
+            }
+
+            runTasks(workerIndex);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--busyWorkers == 0)
+                    workDone.notify_one();
+            }
+        }
+    }
+
+    void ThreadPool::runTasks(int workerIndex)
+    {
+        // Tasks are handed out one index at a time; games are coarse enough that
+        // the atomic increment is noise, and it balances uneven game lengths.
+        for (;;)
+        {
+            std::size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (index >= taskCount)
+                return;
+
+            try
+            {
+                (*currentTask)(index, workerIndex);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!firstError)
+                    firstError = std::current_exception();
+            }
+        }
+    }
+
+} // namespace BBEngine
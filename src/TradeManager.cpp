@@ -1,6 +1,6 @@
 #include "TradeManager.h"
 #include <algorithm>  // for std::find
-#include <iostream>   // for logs
+#include "Log.h"
 
 namespace BBEngine
 {
@@ -31,7 +31,7 @@ namespace BBEngine
         // 1. Check if trade deadline has passed
         if (deadline)
         {
-            std::cerr << "[TradeManager] Trade deadline passed. Cannot execute.\n";
+            BB_LOG_WARNING("[TradeManager] Trade deadline passed. Cannot execute.");
             return false;
         }
         // 2. Validate fromTeam actually has playersToGive,
@@ -43,8 +43,8 @@ namespace BBEngine
             // ensure p is in fromTeam->roster
             if (!fromTeam->hasPlayer(p))
             {
-                std::cerr << "[TradeManager] " << fromTeam->getName()
-                    << " does not have player " << p->getName() << "\n";
+                BB_LOG_WARNING("[TradeManager] " << fromTeam->getName()
+                    << " does not have player " << p->getName());
                 return false;
             }
         }
@@ -53,8 +53,8 @@ namespace BBEngine
         {
             if (!toTeam->hasPlayer(p))
             {
-                std::cerr << "[TradeManager] " << toTeam->getName()
-                    << " does not have player " << p->getName() << "\n";
+                BB_LOG_WARNING("[TradeManager] " << toTeam->getName()
+                    << " does not have player " << p->getName());
                 return false;
             }
         }
@@ -63,14 +63,14 @@ namespace BBEngine
         // fromTeam will receive playersToReceive, toTeam receives playersToGive.
         if (!canTeamAcquirePlayers(fromTeam, playersToReceive))
         {
-            std::cerr << "[TradeManager] " << fromTeam->getName()
-                << " cannot acquire these players (roster size?).\n";
+            BB_LOG_WARNING("[TradeManager] " << fromTeam->getName()
+                << " cannot acquire these players (roster size?).");
             return false;
         }
         if (!canTeamAcquirePlayers(toTeam, playersToGive))
         {
-            std::cerr << "[TradeManager] " << toTeam->getName()
-                << " cannot acquire these players (roster size?).\n";
+            BB_LOG_WARNING("[TradeManager] " << toTeam->getName()
+                << " cannot acquire these players (roster size?).");
             return false;
         }
 
@@ -85,8 +85,8 @@ namespace BBEngine
         auto it = std::find(freeAgents.begin(), freeAgents.end(), freeAgent);
         if (it == freeAgents.end())
         {
-            std::cerr << "[TradeManager] signFreeAgent: " << freeAgent->getName()
-                << " is not a free agent.\n";
+            BB_LOG_WARNING("[TradeManager] signFreeAgent: " << freeAgent->getName()
+                << " is not a free agent.");
             return false;
         }
 
@@ -94,9 +94,9 @@ namespace BBEngine
         std::vector<Player*> onePlayer{ freeAgent };
         if (!canTeamAcquirePlayers(signingTeam, onePlayer))
         {
-            std::cerr << "[TradeManager] " << signingTeam->getName()
+            BB_LOG_WARNING("[TradeManager] " << signingTeam->getName()
                 << " cannot sign " << freeAgent->getName()
-                << " (roster limit?).\n";
+                << " (roster limit?).");
             return false;
         }
 
@@ -105,8 +105,8 @@ namespace BBEngine
         // add to team
         signingTeam->addPlayer(freeAgent);
 
-        std::cout << "[TradeManager] " << signingTeam->getName()
-            << " signed free agent " << freeAgent->getName() << "\n";
+        BB_LOG_INFO("[TradeManager] " << signingTeam->getName()
+            << " signed free agent " << freeAgent->getName());
         return true;
     }
 
@@ -115,18 +115,18 @@ namespace BBEngine
         // ensure p is in fromTeam
         if (!fromTeam->hasPlayer(p))
         {
-            std::cerr << "[TradeManager] releasePlayer: "
+            BB_LOG_WARNING("[TradeManager] releasePlayer: "
                 << fromTeam->getName() << " does not have "
-                << p->getName() << "\n";
+                << p->getName());
             return false;
         }
         // remove from roster
         fromTeam->removePlayer(p);
         // add to freeAgents
         freeAgents.push_back(p);
-        std::cout << "[TradeManager] " << fromTeam->getName()
+        BB_LOG_INFO("[TradeManager] " << fromTeam->getName()
             << " released " << p->getName()
-            << " to free agents.\n";
+            << " to free agents.");
         return true;
     }
 
@@ -156,8 +156,8 @@ namespace BBEngine
         // fromTeam->updateLineupsAfterTrade(...); etc. 
         // For demonstration, we skip that.
 
-        std::cout << "[TradeManager] Trade executed between "
-            << fromTeam->getName() << " and " << toTeam->getName() << "\n";
+        BB_LOG_INFO("[TradeManager] Trade executed between "
+            << fromTeam->getName() << " and " << toTeam->getName());
     }
 
     bool TradeManager::canTeamAcquirePlayers(Team* team, const std::vector<Player*>& newPlayers)
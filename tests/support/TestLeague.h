@@ -0,0 +1,72 @@
+#pragma once
+
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Team.h"
+#include "Player.h"
+#include "PlayerStats.h"
+#include "PlayerAttributes.h"
+#include "StartingRotation.h"
+
+namespace BBEngine
+{
+    // ----------------------------------------------------
+    // A small league of fully staffed teams (9-man lineups, 5-man rotations) with varied
+    // ratings, shared by the tests and the benchmarks. The ratings come from 'ratingSeed', so
+    // the same seed always builds the same league. Everything lives in deques so the pointers
+    // handed to Team stay valid.
+    // ----------------------------------------------------
+    struct TestLeague
+    {
+        std::deque<PlayerAttributes> attributes;
+        std::deque<PlayerStats> stats;
+        std::deque<Player> players;
+        std::deque<StartingRotation> rotations;
+        std::deque<Team> teamStore;
+        std::vector<Team*> teams;
+
+        explicit TestLeague(int teamCount, unsigned ratingSeed = 1)
+        {
+            std::mt19937 gen(ratingSeed);
+            std::uniform_int_distribution<int> rating(30, 90);
+
+            for (int t = 0; t < teamCount; ++t)
+            {
+                std::string teamName = "Team" + std::to_string(t);
+                teamStore.emplace_back(teamName, "MLB");
+                Team* team = &teamStore.back();
+                teams.push_back(team);
+
+                std::vector<Player*> lineup;
+                std::vector<Player*> starters;
+                for (int i = 0; i < 14; ++i)
+                {
+                    attributes.emplace_back();
+                    PlayerAttributes& attr = attributes.back();
+                    attr.setContact(rating(gen));
+                    attr.setPower(rating(gen));
+                    attr.setPlateDiscipline(rating(gen));
+                    attr.setPitchControl(rating(gen));
+                    attr.setPitchVelocity(rating(gen));
+                    stats.emplace_back();
+
+                    players.emplace_back(teamName + " Player" + std::to_string(i), 20 + i,
+                        (i % 2 == 0) ? Handedness::Right : Handedness::Left, &attr, &stats.back());
+                    Player* p = &players.back();
+                    team->addPlayer(p);
+                    if (i < 9) lineup.push_back(p);
+                    else starters.push_back(p);
+                }
+
+                team->setLineupVsRHP(lineup);
+                team->setLineupVsLHP(lineup);
+                rotations.emplace_back(starters);
+                team->setRotation(&rotations.back());
+            }
+        }
+    };
+
+} // namespace BBEngine